@@ -8,9 +8,15 @@
 #include <OpenXLSX.hpp>
 #include <benchmark/benchmark.h>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <numeric>
 #include <deque>
+#include <fstream>
 #include <list>
+#include <random>
+#include <string>
+#include <vector>
 
 using namespace OpenXLSX;
 
@@ -41,6 +47,37 @@ static void BM_WriteStrings(benchmark::State& state)    // NOLINT
 
 BENCHMARK(BM_WriteStrings)->Unit(benchmark::kMillisecond);    // NOLINT
 
+/**
+ * @brief Write 1M distinct strings, so that every write has to look up (and append to) the shared strings table
+ * @param state
+ */
+static void BM_WriteDistinctStrings(benchmark::State& state)    // NOLINT
+{
+    constexpr uint64_t distinctRowCount = 1048576 / colCount;
+
+    XLDocument doc;
+    doc.create("./benchmark_distinct_strings.xlsx");
+    auto wks = doc.workbook().worksheet("Sheet1");
+
+    std::vector<XLCellValue> values(colCount);
+
+    for (auto _ : state) {    // NOLINT
+        uint64_t counter = 0;
+        for (auto& row : wks.rows(distinctRowCount)) {
+            for (auto& value : values) value = "OpenXLSX " + std::to_string(counter++);
+            row.values() = values;
+        }
+    }
+
+    state.SetItemsProcessed(distinctRowCount * colCount);
+    state.counters["items"] = state.items_processed();
+
+    doc.save();
+    doc.close();
+}
+
+BENCHMARK(BM_WriteDistinctStrings)->Unit(benchmark::kMillisecond);    // NOLINT
+
 /**
  * @brief
  * @param state
@@ -213,6 +250,136 @@ static void BM_ReadFloats(benchmark::State& state)    // NOLINT
 
 BENCHMARK(BM_ReadFloats)->Unit(benchmark::kMillisecond);    // NOLINT
 
+/**
+ * @brief Random doubles in the range of typical spreadsheet numbers, used by the number codec comparisons
+ * @return a vector of rowCount values
+ */
+static std::vector<double> randomFloats()
+{
+    std::mt19937                           generator(42);    // NOLINT
+    std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+    std::vector<double>                    result(rowCount);
+    for (auto& value : result) value = distribution(generator);
+    return result;
+}
+
+/**
+ * @brief Format doubles the way cell values were written before the number codec (pugixml and XLStreamWriter used
+ * printf with 17 significant digits), for comparison with BM_WriteFloatsCodec
+ * @param state
+ */
+static void BM_WriteFloatsPrintf(benchmark::State& state)    // NOLINT
+{
+    const std::vector<double> values = randomFloats();
+    char                      buffer[XLNumberBufferSize];
+
+    for (auto _ : state) {    // NOLINT
+        for (double value : values) benchmark::DoNotOptimize(std::snprintf(buffer, sizeof(buffer), "%.17g", value));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * rowCount);
+}
+
+BENCHMARK(BM_WriteFloatsPrintf)->Unit(benchmark::kMillisecond);    // NOLINT
+
+/**
+ * @brief Format doubles with the number codec's shortest round-trip formatting
+ * @param state
+ */
+static void BM_WriteFloatsCodec(benchmark::State& state)    // NOLINT
+{
+    const std::vector<double> values = randomFloats();
+    char                      buffer[XLNumberBufferSize];
+
+    for (auto _ : state) {    // NOLINT
+        for (double value : values) benchmark::DoNotOptimize(formatFloat(value, buffer));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * rowCount);
+}
+
+BENCHMARK(BM_WriteFloatsCodec)->Unit(benchmark::kMillisecond);    // NOLINT
+
+/**
+ * @brief Parse the text of numeric cell values the way it was read before the number codec (pugixml's as_double
+ * uses strtod), for comparison with BM_ReadFloatsCodec
+ * @param state
+ */
+static void BM_ReadFloatsStrtod(benchmark::State& state)    // NOLINT
+{
+    std::vector<std::string> texts;
+    for (double value : randomFloats()) texts.push_back(formatFloat(value));
+
+    for (auto _ : state) {    // NOLINT
+        for (const auto& text : texts) benchmark::DoNotOptimize(std::strtod(text.c_str(), nullptr));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * rowCount);
+}
+
+BENCHMARK(BM_ReadFloatsStrtod)->Unit(benchmark::kMillisecond);    // NOLINT
+
+/**
+ * @brief Parse the text of numeric cell values with the number codec
+ * @param state
+ */
+static void BM_ReadFloatsCodec(benchmark::State& state)    // NOLINT
+{
+    std::vector<std::string> texts;
+    for (double value : randomFloats()) texts.push_back(formatFloat(value));
+
+    for (auto _ : state) {    // NOLINT
+        for (const auto& text : texts) benchmark::DoNotOptimize(textToFloat(text.c_str()));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * rowCount);
+}
+
+BENCHMARK(BM_ReadFloatsCodec)->Unit(benchmark::kMillisecond);    // NOLINT
+
+/**
+ * @brief Parse the text of integer cell values the way it was read before the number codec (strtoll), for comparison
+ * with BM_ReadIntegersCodec
+ * @param state
+ */
+static void BM_ReadIntegersStrtoll(benchmark::State& state)    // NOLINT
+{
+    std::vector<std::string> texts;
+    for (double value : randomFloats()) texts.push_back(std::to_string(static_cast<int64_t>(value * 1e6)));
+
+    for (auto _ : state) {    // NOLINT
+        for (const auto& text : texts) benchmark::DoNotOptimize(std::strtoll(text.c_str(), nullptr, 10));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * rowCount);
+}
+
+BENCHMARK(BM_ReadIntegersStrtoll)->Unit(benchmark::kMillisecond);    // NOLINT
+
+/**
+ * @brief Parse the text of integer cell values with the number codec's eight-digits-at-a-time parser
+ * @param state
+ */
+static void BM_ReadIntegersCodec(benchmark::State& state)    // NOLINT
+{
+    std::vector<std::string> texts;
+    for (double value : randomFloats()) texts.push_back(std::to_string(static_cast<int64_t>(value * 1e6)));
+
+    for (auto _ : state) {    // NOLINT
+        for (const auto& text : texts) benchmark::DoNotOptimize(textToInteger(text.c_str()));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * rowCount);
+}
+
+BENCHMARK(BM_ReadIntegersCodec)->Unit(benchmark::kMillisecond);    // NOLINT
+
 /**
  * @brief
  * @param state
@@ -246,4 +413,181 @@ static void BM_ReadBools(benchmark::State& state)    // NOLINT
 
 BENCHMARK(BM_ReadBools)->Unit(benchmark::kMillisecond);    // NOLINT
 
+/**
+ * @brief Read cells at random coordinates, which requires locating the row node of each cell individually
+ * @param state
+ */
+static void BM_ReadRandomCells(benchmark::State& state)    // NOLINT
+{
+    constexpr uint64_t lookupCount = 4096;
+
+    XLDocument doc;
+    doc.open("./benchmark_integers.xlsx");
+    auto     wks    = doc.workbook().worksheet("Sheet1");
+    uint64_t result = 0;
+
+    std::mt19937                            generator(42);
+    std::uniform_int_distribution<uint32_t> rowDistribution(1, rowCount);
+    std::uniform_int_distribution<uint16_t> colDistribution(1, colCount);
+    std::vector<std::pair<uint32_t, uint16_t>> coordinates(lookupCount);
+    for (auto& coordinate : coordinates) coordinate = { rowDistribution(generator), colDistribution(generator) };
+
+    for (auto _ : state) {    // NOLINT
+        for (const auto& [row, col] : coordinates) result += wks.findCell(row, col).value().get<uint64_t>();
+
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(lookupCount);
+    state.counters["items"] = state.items_processed();
+
+    doc.close();
+}
+
+BENCHMARK(BM_ReadRandomCells)->Unit(benchmark::kMillisecond);    // NOLINT
+
+/**
+ * @brief Iterate a cell range over a worksheet in which every cell exists, reporting the cost per cell visited
+ * @param state
+ */
+static void BM_IterateDenseRows(benchmark::State& state)    // NOLINT
+{
+    constexpr uint32_t iterateRowCount = 65536;
+    constexpr uint16_t iterateColCount = 64;
+
+    XLDocument doc;
+    doc.create("./benchmark_iterate.xlsx");
+    auto wks = doc.workbook().worksheet("Sheet1");
+    for (auto& row : wks.rows(iterateRowCount)) row.values() = std::vector<int>(iterateColCount, 1);
+
+    auto     range  = wks.range(XLCellReference(1, 1), XLCellReference(iterateRowCount, iterateColCount));
+    uint64_t result = 0;
+    for (auto _ : state) {    // NOLINT
+        for (auto it = range.begin(); it != range.end(); ++it)
+            if (it.cellExists()) ++result;
+
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * iterateRowCount * iterateColCount);
+    doc.close();
+}
+
+BENCHMARK(BM_IterateDenseRows)->Unit(benchmark::kMillisecond);    // NOLINT
+
+/**
+ * @brief Iterate a cell range over a worksheet in which only every 8th cell of a row exists, reporting the cost per cell visited
+ * @param state
+ */
+static void BM_IterateSparseRows(benchmark::State& state)    // NOLINT
+{
+    constexpr uint32_t iterateRowCount = 65536;
+    constexpr uint16_t iterateColCount = 64;
+
+    XLDocument doc;
+    doc.create("./benchmark_iterate.xlsx");
+    auto wks = doc.workbook().worksheet("Sheet1");
+    for (uint32_t row = 1; row <= iterateRowCount; ++row)
+        for (uint16_t col = 8; col <= iterateColCount; col += 8) wks.cell(row, col).value() = 1;
+
+    auto     range  = wks.range(XLCellReference(1, 1), XLCellReference(iterateRowCount, iterateColCount));
+    uint64_t result = 0;
+    for (auto _ : state) {    // NOLINT
+        for (auto it = range.begin(); it != range.end(); ++it)
+            if (it.cellExists()) ++result;
+
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * iterateRowCount * iterateColCount);
+    doc.close();
+}
+
+BENCHMARK(BM_IterateSparseRows)->Unit(benchmark::kMillisecond);    // NOLINT
+
+/**
+ * @brief Save a workbook with 256K rows of integers using the compression level given by the benchmark argument, or with
+ * a mixed policy (store package parts, level 1 for worksheets) for argument -2. Reports the resulting file size.
+ * @param state
+ */
+static void BM_SaveCompressionLevel(benchmark::State& state)    // NOLINT
+{
+    constexpr uint64_t saveRowCount = 262144;
+
+    XLDocument doc;
+    doc.create("./benchmark_compression.xlsx");
+    auto wks = doc.workbook().worksheet("Sheet1");
+
+    std::vector<XLCellValue> values(colCount);
+    uint64_t                 counter = 0;
+    for (auto& row : wks.rows(saveRowCount)) {
+        for (auto& value : values) value = counter++;
+        row.values() = values;
+    }
+
+    XLZipSaveOptions options;
+    if (state.range(0) == -2)
+        options.rules = { { "*.rels", 0 }, { "[Content_Types].xml", 0 }, { "docProps/*", 0 }, { "xl/worksheets/*", 1 } };
+    else
+        options.compressionLevel = static_cast<int>(state.range(0));
+
+    for (auto _ : state) doc.saveAs("./benchmark_compression.xlsx", XLForceOverwrite, options);    // NOLINT
+
+    state.SetItemsProcessed(saveRowCount * colCount);
+    state.counters["items"] = state.items_processed();
+    doc.close();
+
+    std::ifstream file("./benchmark_compression.xlsx", std::ios::binary | std::ios::ate);
+    state.counters["bytes"] = static_cast<double>(file.tellg());
+}
+
+BENCHMARK(BM_SaveCompressionLevel)->Arg(0)->Arg(1)->Arg(6)->Arg(9)->Arg(-2)->Unit(benchmark::kMillisecond);    // NOLINT
+
+/**
+ * @brief Open a workbook with the number of worksheets given by the first benchmark argument (64K rows of integers each)
+ * and read one cell from every sheet, parsing the worksheets lazily (second argument 0) or on open in parallel (1)
+ * @param state
+ */
+static void BM_OpenWorkbook(benchmark::State& state)    // NOLINT
+{
+    constexpr uint64_t sheetRowCount = 65536;
+
+    const auto        sheetCount = static_cast<uint16_t>(state.range(0));
+    const std::string fileName   = "./benchmark_sheets_" + std::to_string(sheetCount) + ".xlsx";
+    {
+        XLDocument doc;
+        doc.create(fileName, XLForceOverwrite);
+        std::vector<XLCellValue> values(colCount, 42);
+        for (uint16_t i = 1; i <= sheetCount; ++i) {
+            if (i > 1) doc.workbook().addWorksheet("Sheet" + std::to_string(i));
+            auto wks = doc.workbook().worksheet("Sheet" + std::to_string(i));
+            for (auto& row : wks.rows(sheetRowCount)) row.values() = values;
+        }
+        doc.save();
+        doc.close();
+    }
+
+    XLOpenOptions options;
+    options.parseWorksheets = state.range(1) != 0;
+    uint64_t result         = 0;
+
+    for (auto _ : state) {    // NOLINT
+        XLDocument doc;
+        doc.open(fileName, options);
+        for (const auto& name : doc.workbook().worksheetNames())
+            result += doc.workbook().worksheet(name).findCell(sheetRowCount, 1).value().get<uint64_t>();
+        doc.close();
+
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(sheetCount * sheetRowCount * colCount);
+    state.counters["items"] = state.items_processed();
+}
+
+BENCHMARK(BM_OpenWorkbook)->ArgsProduct({ { 1, 4, 8 }, { 0, 1 } })->Unit(benchmark::kMillisecond);    // NOLINT
+
 #pragma warning(pop)
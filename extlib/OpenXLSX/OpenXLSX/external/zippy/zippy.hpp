@@ -15,14 +15,18 @@
 #endif // _MSC_VER
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdio>
+#include <exception>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <random>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 #ifdef _WIN32
@@ -10036,6 +10040,8 @@ namespace Zippy
 
                 m_EntryData  = result;
                 m_IsModified = true;
+                ZipEntryData().swap(m_DeflatedData);
+                m_IsDeflated = false;
             }
 
             /**
@@ -10046,6 +10052,8 @@ namespace Zippy
             {
                 m_EntryData  = data;
                 m_IsModified = true;
+                ZipEntryData().swap(m_DeflatedData);
+                m_IsDeflated = false;
             }
 
             /**
@@ -10150,6 +10158,12 @@ namespace Zippy
 
             bool m_IsModified = false; /**< Boolean flag indicating if the file has been modified since opening. */
 
+            // ===== Data of an entry that was added already compressed; it is only inflated into m_EntryData when read.
+            ZipEntryData m_DeflatedData = ZipEntryData(); /**< The raw deflate stream of the entry data. */
+            uint32_t     m_DeflatedCrc  = 0;              /**< The CRC-32 of the uncompressed entry data. */
+            uint64_t     m_DeflatedSize = 0;              /**< The size of the uncompressed entry data. */
+            bool         m_IsDeflated   = false;          /**< Whether the entry data is held in m_DeflatedData. */
+
             /**
              * @brief Has the zip entry been modified?
              * @return Returns true if the entry is has been modified; otherwise false.
@@ -10411,6 +10425,152 @@ namespace Zippy
     };
 }    // namespace Zippy
 
+namespace Zippy::Impl
+{
+    /**
+     * @brief Entries larger than this are split into chunks of this size that are deflated independently, so that a single
+     * large entry can be compressed by several threads. The chunks lose the shared dictionary at their boundaries, which
+     * costs a negligible amount of compression at this size.
+     */
+    constexpr size_t DeflateChunkSize = 4 * 1024 * 1024;
+
+    /**
+     * @brief A unit of work for the parallel compression in ZipArchive::Save: one chunk of the data of one entry.
+     */
+    struct DeflateTask
+    {
+        const unsigned char* Data;   /**< Start of the chunk. */
+        size_t               Size;   /**< Size of the chunk. */
+        bool                 IsLast; /**< Whether this is the final chunk of the entry. */
+        int                  Level;  /**< The miniz compression level (1-10) for the entry. */
+        ZipEntryData         Output; /**< The raw deflate data for the chunk. */
+    };
+
+    /**
+     * @brief Deflate a chunk of data as a raw deflate stream (no zlib header), as stored in .zip archives.
+     * @details All chunks but the last of an entry end with a sync flush instead of a final block. This leaves the stream
+     * byte-aligned and open, so that the output of consecutive chunks can be concatenated into a single valid stream.
+     * @param task The chunk to compress. The result is written to task.Output.
+     */
+    inline void DeflateChunk(DeflateTask& task)
+    {
+        std::unique_ptr<tdefl_compressor, void (*)(tdefl_compressor*)> compressor(tdefl_compressor_alloc(), tdefl_compressor_free);
+        if (!compressor) throw ZipRuntimeError("Failed to allocate deflate compressor");
+
+        auto putBuffer = [](const void* buffer, int length, void* user) -> mz_bool {
+            auto* output = static_cast<ZipEntryData*>(user);
+            output->insert(output->end(), static_cast<const unsigned char*>(buffer), static_cast<const unsigned char*>(buffer) + length);
+            return MZ_TRUE;
+        };
+
+        task.Output.reserve(task.Size / 4);
+        const mz_uint flags = tdefl_create_comp_flags_from_zip_params(task.Level, -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY);
+        if (tdefl_init(compressor.get(), putBuffer, &task.Output, static_cast<int>(flags)) != TDEFL_STATUS_OKAY)
+            throw ZipRuntimeError("Failed to initialize deflate compressor");
+
+        const tdefl_status expected = task.IsLast ? TDEFL_STATUS_DONE : TDEFL_STATUS_OKAY;
+        if (tdefl_compress_buffer(compressor.get(), task.Data, task.Size, task.IsLast ? TDEFL_FINISH : TDEFL_SYNC_FLUSH) != expected)
+            throw ZipRuntimeError("Failed to deflate archive entry");
+    }
+
+    /**
+     * @brief Run all deflate tasks on up to threadCount threads. The output of each task is independent of the number of
+     * threads and of the order in which the tasks are picked up.
+     * @param tasks The tasks to run.
+     * @param threadCount The maximum number of threads to use; the calling thread is one of them.
+     */
+    inline void RunDeflateTasks(std::vector<DeflateTask>& tasks, unsigned threadCount)
+    {
+        std::atomic<size_t> next { 0 };
+        std::exception_ptr  error;
+        std::atomic<bool>   failed { false };
+
+        auto worker = [&]() {
+            for (size_t i = next++; i < tasks.size() && !failed; i = next++) {
+                try {
+                    DeflateChunk(tasks[i]);
+                }
+                catch (...) {
+                    if (!failed.exchange(true)) error = std::current_exception();
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        const size_t extraThreads = std::min<size_t>(std::max(threadCount, 1u), tasks.size()) - (tasks.empty() ? 0 : 1);
+        threads.reserve(extraThreads);
+        for (size_t i = 0; i < extraThreads; ++i) threads.emplace_back(worker);
+        worker();
+        for (auto& thread : threads) thread.join();
+
+        if (error) std::rethrow_exception(error);
+    }
+
+    /**
+     * @brief Deflates data incrementally into a raw deflate stream, as stored in .zip archives. Only the compressed
+     * output is kept in memory, together with the CRC-32 and size of the uncompressed data.
+     */
+    class DeflateStream
+    {
+    public:
+        /**
+         * @brief Constructor.
+         * @param level The deflate level from 0 (store) to 10; a negative level selects the default level.
+         */
+        explicit DeflateStream(int level) : m_Compressor(tdefl_compressor_alloc(), tdefl_compressor_free)
+        {
+            if (!m_Compressor) throw ZipRuntimeError("Failed to allocate deflate compressor");
+            if (level < 0) level = MZ_DEFAULT_LEVEL;
+            level = std::min(level, static_cast<int>(MZ_UBER_COMPRESSION));
+
+            const mz_uint flags = tdefl_create_comp_flags_from_zip_params(level, -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY);
+            if (tdefl_init(m_Compressor.get(), PutBuffer, &m_Output, static_cast<int>(flags)) != TDEFL_STATUS_OKAY)
+                throw ZipRuntimeError("Failed to initialize deflate compressor");
+        }
+
+        DeflateStream(const DeflateStream& other)            = delete;
+        DeflateStream& operator=(const DeflateStream& other) = delete;
+
+        /**
+         * @brief Compress the next part of the data.
+         */
+        void Write(const void* data, size_t size)
+        {
+            m_Crc = mz_crc32(m_Crc, static_cast<const unsigned char*>(data), size);
+            m_Size += size;
+            if (tdefl_compress_buffer(m_Compressor.get(), data, size, TDEFL_NO_FLUSH) != TDEFL_STATUS_OKAY)
+                throw ZipRuntimeError("Failed to deflate archive entry");
+        }
+
+        /**
+         * @brief Complete the deflate stream. No data may be written afterwards.
+         */
+        void Finish()
+        {
+            if (tdefl_compress_buffer(m_Compressor.get(), nullptr, 0, TDEFL_FINISH) != TDEFL_STATUS_DONE)
+                throw ZipRuntimeError("Failed to deflate archive entry");
+        }
+
+        ZipEntryData& Output() { return m_Output; }
+        uint32_t      Crc() const { return static_cast<uint32_t>(m_Crc); }
+        uint64_t      Size() const { return m_Size; }
+
+    private:
+        static mz_bool PutBuffer(const void* buffer, int length, void* user)
+        {
+            auto* output = static_cast<ZipEntryData*>(user);
+            output->insert(output->end(), static_cast<const unsigned char*>(buffer), static_cast<const unsigned char*>(buffer) + length);
+            return MZ_TRUE;
+        }
+
+        std::unique_ptr<tdefl_compressor, void (*)(tdefl_compressor*)> m_Compressor;
+        ZipEntryData                                                    m_Output {};
+        mz_ulong                                                        m_Crc { MZ_CRC32_INIT };
+        uint64_t                                                        m_Size { 0 };
+    };
+
+}    // namespace Zippy::Impl
+
 namespace Zippy
 {
     /**
@@ -10818,10 +10978,27 @@ namespace Zippy
         /**
          * @brief Save the archive with a new name. The original archive will remain unchanged.
          * @param filename The new filename.
+         * @param level The miniz compression level for modified entries: 0 stores them uncompressed, 1-10 trade speed for
+         * size, and MZ_DEFAULT_COMPRESSION selects the default level. Unmodified entries are copied as they are.
+         * @param threadCount The number of threads used to deflate modified entries. The output does not depend on it.
+         * @note If no filename is provided, the file will be saved with the existing name, overwriting any existing data.
+         * @throws ZipException A ZipException object is thrown if calls to miniz function fails.
+         */
+        void Save(std::string filename = "", int level = MZ_DEFAULT_COMPRESSION, unsigned threadCount = 1)
+        {
+            Save(std::move(filename), [level](const std::string&) { return level; }, threadCount);
+        }
+
+        /**
+         * @brief Save the archive, selecting the compression level of each modified entry individually.
+         * @param filename The new filename.
+         * @param levelForEntry Returns the miniz compression level for the entry with the given name, as for the level
+         * parameter of Save(std::string, int, unsigned).
+         * @param threadCount The number of threads used to deflate modified entries. The output does not depend on it.
          * @note If no filename is provided, the file will be saved with the existing name, overwriting any existing data.
          * @throws ZipException A ZipException object is thrown if calls to miniz function fails.
          */
-        void Save(std::string filename = "")
+        void Save(std::string filename, const std::function<int(const std::string&)>& levelForEntry, unsigned threadCount)
         {
             if (!IsOpen()) throw ZipLogicError("Cannot call Save on empty ZipArchive object!");
 
@@ -10854,8 +11031,31 @@ namespace Zippy
             if (!mz_zip_writer_init_file(&tempArchive, tempPath.c_str(), 0))              // pull request #210
                 throw ZipRuntimeError(mz_zip_get_error_string(tempArchive.m_last_error)); //  "
 
+            // ===== Deflate the data of all modified entries up front, on several threads. Each entry is split into chunks
+            // ===== so that large entries are spread over the threads as well; the chunks are reassembled in order below.
+            std::vector<Impl::DeflateTask> tasks;
+            std::vector<size_t>            firstTask(m_ZipEntries.size(), 0);
+            std::vector<int>               levels(m_ZipEntries.size(), 0);
+            for (size_t i = 0; i < m_ZipEntries.size(); ++i) {
+                const auto& file = m_ZipEntries[i];
+                if (file.IsDirectory() || !file.IsModified() || file.m_IsDeflated) continue;
+                int level = levelForEntry(file.GetName());
+                if (level < 0) level = MZ_DEFAULT_LEVEL;
+                levels[i] = std::min(level, static_cast<int>(MZ_UBER_COMPRESSION));
+                if (levels[i] == 0) continue;
+                firstTask[i] = tasks.size();
+                size_t offset = 0;
+                do {
+                    const size_t size = std::min(Impl::DeflateChunkSize, file.m_EntryData.size() - offset);
+                    tasks.push_back({ file.m_EntryData.data() + offset, size, offset + size == file.m_EntryData.size(), levels[i], {} });
+                    offset += size;
+                } while (offset < file.m_EntryData.size());
+            }
+            Impl::RunDeflateTasks(tasks, threadCount);
+
             // ===== Iterate through the ZipEntries and add entries to the temporary file
-            for (auto& file : m_ZipEntries) {
+            for (size_t i = 0; i < m_ZipEntries.size(); ++i) {
+                auto& file = m_ZipEntries[i];
                 if (file.IsDirectory()) continue;    // TODO: Ensure this is the right thing to do (Excel issue)
                 if (!file.IsModified()) {
                     if (!mz_zip_writer_add_from_zip_reader(&tempArchive, &m_Archive, file.Index())) {
@@ -10863,15 +11063,50 @@ namespace Zippy
                     }
                 }
 
-                else {
+                else if (file.m_IsDeflated) {
+                    if (!mz_zip_writer_add_mem_ex(&tempArchive,
+                                                  file.GetName().c_str(),
+                                                  file.m_DeflatedData.data(),
+                                                  file.m_DeflatedData.size(),
+                                                  nullptr,
+                                                  0,
+                                                  MZ_DEFAULT_LEVEL | MZ_ZIP_FLAG_COMPRESSED_DATA,
+                                                  file.m_DeflatedSize,
+                                                  file.m_DeflatedCrc)) {
+                        throw ZipRuntimeError(mz_zip_get_error_string(tempArchive.m_last_error));
+                    }
+                }
+
+                else if (levels[i] == 0) {
                     if (!mz_zip_writer_add_mem(&tempArchive,
                                                file.GetName().c_str(),
                                                file.m_EntryData.data(),
                                                file.m_EntryData.size(),
-                                               MZ_DEFAULT_COMPRESSION)) {
-                        throw ZipRuntimeError(mz_zip_get_error_string(m_Archive.m_last_error));
+                                               MZ_NO_COMPRESSION)) {
+                        throw ZipRuntimeError(mz_zip_get_error_string(tempArchive.m_last_error));
                     }
                 }
+
+                else {
+                    ZipEntryData& deflated = tasks[firstTask[i]].Output;
+                    for (size_t t = firstTask[i] + 1; t < tasks.size() && !tasks[t - 1].IsLast; ++t) {
+                        deflated.insert(deflated.end(), tasks[t].Output.begin(), tasks[t].Output.end());
+                        ZipEntryData().swap(tasks[t].Output);
+                    }
+                    const auto entryCrc = static_cast<mz_uint32>(mz_crc32(MZ_CRC32_INIT, file.m_EntryData.data(), file.m_EntryData.size()));
+                    if (!mz_zip_writer_add_mem_ex(&tempArchive,
+                                                  file.GetName().c_str(),
+                                                  deflated.data(),
+                                                  deflated.size(),
+                                                  nullptr,
+                                                  0,
+                                                  static_cast<mz_uint>(levels[i]) | MZ_ZIP_FLAG_COMPRESSED_DATA,
+                                                  file.m_EntryData.size(),
+                                                  entryCrc)) {
+                        throw ZipRuntimeError(mz_zip_get_error_string(tempArchive.m_last_error));
+                    }
+                    ZipEntryData().swap(deflated);
+                }
             }
 
             // ===== Finalize and close the temporary archive
@@ -10930,6 +11165,8 @@ namespace Zippy
                 return name == entry.GetName();
             });
 
+            if (result->m_IsDeflated) InflateEntry(*result);
+
             // ===== If data has not been extracted from the archive (i.e., m_EntryData is empty),
             // ===== extract the data from the archive to the ZipEntry object.
             if (result->m_EntryData.empty()) {
@@ -10949,6 +11186,192 @@ namespace Zippy
             return ZipEntry(&*result);
         }
 
+        /**
+         * @brief Extract the data of the entry with the specified name into a newly allocated buffer.
+         * @details Unlike GetEntry, the data is not kept in the ZipArchive object: an unmodified entry is decompressed
+         * straight into the buffer, and data of an unmodified entry that was extracted earlier (e.g. by PrefetchEntries)
+         * is released once it has been copied. The data of a modified entry is copied and kept.
+         * @param name The name of the entry in the archive.
+         * @param size Receives the size of the entry data.
+         * @param allocate The function used to allocate the buffer (at least one byte is allocated); the caller takes
+         * ownership of the returned buffer.
+         * @param deallocate The function used to release the buffer if the extraction fails.
+         * @return A pointer to the buffer holding the entry data.
+         */
+        void* ExtractEntryToBuffer(const std::string& name, size_t& size, void* (*allocate)(size_t), void (*deallocate)(void*))
+        {
+            if (!IsOpen()) throw ZipLogicError("Cannot call ExtractEntryToBuffer on empty ZipArchive object!");
+
+            auto result = std::find_if(m_ZipEntries.begin(), m_ZipEntries.end(), [&](const Impl::ZipEntry& entry) {
+                return name == entry.GetName();
+            });
+            if (result == m_ZipEntries.end() || result->IsDirectory())
+                throw ZipLogicError("Cannot extract \"" + name + "\": no such file entry in the archive!");
+            if (result->m_IsDeflated) InflateEntry(*result);
+
+            size = result->IsModified() ? result->m_EntryData.size() : static_cast<size_t>(result->UncompressedSize());
+            void* buffer = allocate(size ? size : 1);
+            if (!buffer) throw ZipRuntimeError("Cannot allocate memory for entry \"" + name + "\"");
+
+            if (!result->m_EntryData.empty()) {
+                std::copy_n(result->m_EntryData.data(), size, static_cast<unsigned char*>(buffer));
+                if (!result->IsModified()) ZipEntryData().swap(result->m_EntryData);
+            }
+            else if (size && !mz_zip_reader_extract_to_mem(&m_Archive, result->Index(), buffer, size, 0)) {
+                deallocate(buffer);
+                throw ZipRuntimeError(mz_zip_get_error_string(m_Archive.m_last_error));
+            }
+
+            return buffer;
+        }
+
+        /**
+         * @brief Open a forward-only stream over the data of the entry with the specified name.
+         * @details An entry whose data is held in memory (because it was modified or extracted before) is read from
+         * there; any other entry is decompressed incrementally from the archive, so that only the part that is actually
+         * read is inflated. The returned function must not be called after the archive was closed or modified.
+         * @param name The name of the entry in the archive.
+         * @return A function that copies up to size bytes of the entry data to buffer and returns the number of bytes
+         * copied, which is 0 once the end of the data is reached.
+         */
+        std::function<size_t(char*, size_t)> OpenEntryStream(const std::string& name)
+        {
+            if (!IsOpen()) throw ZipLogicError("Cannot call OpenEntryStream on empty ZipArchive object!");
+
+            auto result = std::find_if(m_ZipEntries.begin(), m_ZipEntries.end(), [&](const Impl::ZipEntry& entry) {
+                return name == entry.GetName();
+            });
+            if (result == m_ZipEntries.end() || result->IsDirectory())
+                throw ZipLogicError("Cannot stream \"" + name + "\": no such file entry in the archive!");
+            if (result->m_IsDeflated) InflateEntry(*result);
+
+            // ===== A modified entry is always read from memory, even if its new data is empty: the archive holds the old
+            // data of a replaced entry, and nothing for a new one.
+            if (result->IsModified() || !result->m_EntryData.empty()) {
+                const auto*  data   = result->m_EntryData.data();
+                const size_t size   = result->IsModified() ? result->m_EntryData.size() : static_cast<size_t>(result->UncompressedSize());
+                size_t       offset = 0;
+                return [data, size, offset](char* buffer, size_t count) mutable {
+                    count = std::min(count, size - offset);
+                    std::copy_n(data + offset, count, buffer);
+                    offset += count;
+                    return count;
+                };
+            }
+
+            std::shared_ptr<mz_zip_reader_extract_iter_state> state(mz_zip_reader_extract_iter_new(&m_Archive, result->Index(), 0),
+                                                                    [](mz_zip_reader_extract_iter_state* iter) {
+                                                                        if (iter) mz_zip_reader_extract_iter_free(iter);
+                                                                    });
+            if (!state) throw ZipRuntimeError(mz_zip_get_error_string(m_Archive.m_last_error));
+
+            return [state](char* buffer, size_t count) {
+                const size_t read = mz_zip_reader_extract_iter_read(state.get(), buffer, count);
+                if (state->status < TINFL_STATUS_DONE) throw ZipRuntimeError("Failed to decompress entry data");
+                return read;
+            };
+        }
+
+        /**
+         * @brief Open a writer for the data of a new or replaced entry, which deflates the data as it is written.
+         * @details Only the compressed data is kept in memory. The entry becomes part of the archive when the writer is
+         * called with a size of 0, and is saved without being compressed again. The returned function must not be
+         * called after the archive was closed.
+         * @param name The name of the entry in the archive.
+         * @param level The deflate level from 0 (store) to 10; a negative level selects the default level.
+         * @return A function that compresses size bytes from data, or completes the entry if size is 0.
+         */
+        std::function<void(const char*, size_t)> OpenEntryWriter(const std::string& name, int level = MZ_DEFAULT_LEVEL)
+        {
+            if (!IsOpen()) throw ZipLogicError("Cannot call OpenEntryWriter on empty ZipArchive object!");
+
+            auto stream = std::make_shared<Impl::DeflateStream>(level);
+            return [this, name, stream](const char* data, size_t size) {
+                if (size) {
+                    stream->Write(data, size);
+                    return;
+                }
+                stream->Finish();
+                AddDeflatedEntry(name, std::move(stream->Output()), stream->Crc(), stream->Size());
+            };
+        }
+
+        /**
+         * @brief Add an entry whose data is already compressed as a raw deflate stream, or replace the data of an
+         * existing entry with it.
+         * @param name The name of the entry in the archive.
+         * @param deflated The raw deflate stream of the entry data.
+         * @param crc The CRC-32 of the uncompressed entry data.
+         * @param size The size of the uncompressed entry data.
+         */
+        void AddDeflatedEntry(const std::string& name, ZipEntryData&& deflated, uint32_t crc, uint64_t size)
+        {
+            AddEntryImpl(name, ZipEntryData());
+            auto result = std::find_if(m_ZipEntries.begin(), m_ZipEntries.end(), [&](const Impl::ZipEntry& entry) {
+                return name == entry.GetName();
+            });
+            result->m_DeflatedData = std::move(deflated);
+            result->m_DeflatedCrc  = crc;
+            result->m_DeflatedSize = size;
+            result->m_IsDeflated   = true;
+        }
+
+        /**
+         * @brief Extract the data of several entries into memory, on several threads.
+         * @details Each thread opens its own reader on the archive file, so that entries are decompressed concurrently.
+         * Afterwards, GetEntry and ExtractEntryToBuffer return the data of these entries without accessing the archive
+         * file, which makes it safe to call them for distinct entries from several threads, as long as the archive is not
+         * modified meanwhile.
+         * Entries that are unknown, directories, modified or already extracted are skipped.
+         * @param names The names of the entries to extract.
+         * @param threadCount The maximum number of threads to use; the calling thread is one of them.
+         */
+        void PrefetchEntries(const std::vector<std::string>& names, unsigned threadCount)
+        {
+            if (!IsOpen()) throw ZipLogicError("Cannot call PrefetchEntries on empty ZipArchive object!");
+
+            std::vector<Impl::ZipEntry*> pending;
+            for (const auto& name : names) {
+                auto result = std::find_if(m_ZipEntries.begin(), m_ZipEntries.end(), [&](const Impl::ZipEntry& entry) {
+                    return name == entry.GetName();
+                });
+                if (result == m_ZipEntries.end() || result->IsDirectory() || result->IsModified() || !result->m_EntryData.empty()) continue;
+                pending.push_back(&*result);
+            }
+            if (pending.empty()) return;
+
+            std::atomic<size_t> next { 0 };
+            std::exception_ptr  error;
+            std::atomic<bool>   failed { false };
+
+            auto worker = [&]() {
+                mz_zip_archive reader = mz_zip_archive();
+                if (!mz_zip_reader_init_file(&reader, m_ArchivePath.c_str(), 0)) {
+                    if (!failed.exchange(true)) error = std::make_exception_ptr(ZipRuntimeError(mz_zip_get_error_string(reader.m_last_error)));
+                    return;
+                }
+                for (size_t i = next++; i < pending.size() && !failed; i = next++) {
+                    auto& entry = *pending[i];
+                    entry.m_EntryData.resize(entry.UncompressedSize() ? entry.UncompressedSize() : 1); // see GetEntry
+                    if (!mz_zip_reader_extract_to_mem(&reader, entry.Index(), entry.m_EntryData.data(), entry.m_EntryData.size(), 0)
+                        && entry.UncompressedSize()) {
+                        ZipEntryData().swap(entry.m_EntryData);
+                        if (!failed.exchange(true)) error = std::make_exception_ptr(ZipRuntimeError(mz_zip_get_error_string(reader.m_last_error)));
+                    }
+                }
+                mz_zip_reader_end(&reader);
+            };
+
+            std::vector<std::thread> threads;
+            const size_t extraThreads = std::min<size_t>(std::max(threadCount, 1u), pending.size()) - 1;
+            threads.reserve(extraThreads);
+            for (size_t i = 0; i < extraThreads; ++i) threads.emplace_back(worker);
+            worker();
+            for (auto& thread : threads) thread.join();
+
+            if (error) std::rethrow_exception(error);
+        }
+
         /**
          * @brief Extract the entry with the provided name to the destination path.
          * @param name The name of the entry to extract.
@@ -11048,6 +11471,23 @@ namespace Zippy
         }
 
     private:
+        /**
+         * @brief Inflate the data of an entry that was added already compressed, so that it can be read.
+         * @param entry The entry to inflate; it keeps being a modified entry.
+         */
+        static void InflateEntry(Impl::ZipEntry& entry)
+        {
+            ZipEntryData data(entry.m_DeflatedSize);
+            if (entry.m_DeflatedSize
+                && tinfl_decompress_mem_to_mem(data.data(), data.size(), entry.m_DeflatedData.data(), entry.m_DeflatedData.size(), 0)
+                       != data.size())
+                throw ZipRuntimeError("Failed to inflate archive entry");
+
+            entry.m_EntryData = std::move(data);
+            ZipEntryData().swap(entry.m_DeflatedData);
+            entry.m_IsDeflated = false;
+        }
+
         /**
          * @brief Add a new entry to the archive.
          * @param name The name of the entry to add.
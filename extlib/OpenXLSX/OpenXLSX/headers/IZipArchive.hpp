@@ -55,11 +55,51 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 // ===== OpenXLSX Includes ===== //
 #include "OpenXLSX-Exports.hpp"
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace OpenXLSX
 {
+    /**
+     * @brief A forward-only reader of the data of an archive entry: copies up to size bytes to buffer and returns the
+     * number of bytes copied, which is 0 once the end of the data is reached.
+     */
+    using XLZipEntryStream = std::function<size_t(char* buffer, size_t size)>;
+
+    /**
+     * @brief A forward-only writer of the data of a new or replaced archive entry: compresses size bytes from data, or
+     * completes the entry when called with a size of 0.
+     */
+    using XLZipEntrySink = std::function<void(const char* data, size_t size)>;
+
+    /**
+     * @brief A compression level for the archive entries whose name matches a pattern.
+     */
+    struct XLZipCompressionRule
+    {
+        std::string pattern {};               /**< Entry name pattern, in which '*' matches any sequence of characters. >*/
+        int         compressionLevel { -1 };  /**< Deflate level from 0 (store) to 10 (smallest); negative selects the default. >*/
+    };
+
+    /**
+     * @brief Options that control how an archive is written when it is saved. Only entries that were added or modified
+     * since the archive was opened are compressed; all other entries are copied through unchanged.
+     * @details The level of an entry is taken from the first rule whose pattern matches the entry name, or from
+     * compressionLevel if no rule matches. E.g., to store the small package parts and compress worksheets quickly:
+     * ```cpp
+     * XLZipSaveOptions options;
+     * options.rules = { { "*.rels", 0 }, { "[Content_Types].xml", 0 }, { "xl/worksheets/sheet*.xml", 1 } };
+     * ```
+     */
+    struct XLZipSaveOptions
+    {
+        int                               compressionLevel { -1 }; /**< Deflate level from 0 (store) to 10 (smallest); negative selects the default. >*/
+        unsigned                          threadCount { 0 };       /**< Number of threads used for compression; 0 uses all hardware threads. >*/
+        std::vector<XLZipCompressionRule> rules {};                /**< Per entry overrides of compressionLevel; the first match applies. >*/
+    };
+
     /**
      * @brief This class functions as a wrapper around any class that provides the necessary functionality for
      * a zip archive.
@@ -159,8 +199,8 @@ namespace OpenXLSX
             m_zipArchive->close();
         }
 
-        inline void save(const std::string& path) {
-            m_zipArchive->save(path);
+        inline void save(const std::string& path, const XLZipSaveOptions& options = XLZipSaveOptions{}) {
+            m_zipArchive->save(path, options);
         }
 
         inline void addEntry(const std::string& name, const std::string& data) {
@@ -179,6 +219,22 @@ namespace OpenXLSX
             return m_zipArchive->hasEntry(entryName);
         }
 
+        inline void* getEntryBuffer(const std::string& name, size_t& size, void* (*allocate)(size_t), void (*deallocate)(void*)) {
+            return m_zipArchive->getEntryBuffer(name, size, allocate, deallocate);
+        }
+
+        inline XLZipEntryStream openEntryStream(const std::string& name) {
+            return m_zipArchive->openEntryStream(name);
+        }
+
+        inline XLZipEntrySink openEntrySink(const std::string& name, int compressionLevel) {
+            return m_zipArchive->openEntrySink(name, compressionLevel);
+        }
+
+        inline void prefetchEntries(const std::vector<std::string>& names, unsigned threadCount) {
+            m_zipArchive->prefetchEntries(names, threadCount);
+        }
+
     private:
         /**
          * @brief
@@ -232,7 +288,7 @@ namespace OpenXLSX
 
             inline virtual void close() = 0;
 
-            inline virtual void save (const std::string& path) = 0;
+            inline virtual void save (const std::string& path, const XLZipSaveOptions& options) = 0;
 
             inline virtual void addEntry(const std::string& name, const std::string& data) = 0;
 
@@ -242,6 +298,14 @@ namespace OpenXLSX
 
             inline virtual bool hasEntry(const std::string& entryName) const = 0;
 
+            inline virtual void* getEntryBuffer(const std::string& name, size_t& size, void* (*allocate)(size_t), void (*deallocate)(void*)) = 0;
+
+            inline virtual XLZipEntryStream openEntryStream(const std::string& name) = 0;
+
+            inline virtual XLZipEntrySink openEntrySink(const std::string& name, int compressionLevel) = 0;
+
+            inline virtual void prefetchEntries(const std::vector<std::string>& names, unsigned threadCount) = 0;
+
         };
 
         /**
@@ -314,8 +378,8 @@ namespace OpenXLSX
                 ZipType.close();
             }
 
-            inline void save(const std::string& path) override {
-                ZipType.save(path);
+            inline void save(const std::string& path, const XLZipSaveOptions& options) override {
+                ZipType.save(path, options);
             }
 
             inline void addEntry(const std::string& name, const std::string& data) override {
@@ -334,6 +398,22 @@ namespace OpenXLSX
                 return ZipType.hasEntry(entryName);
             }
 
+            inline void* getEntryBuffer(const std::string& name, size_t& size, void* (*allocate)(size_t), void (*deallocate)(void*)) override {
+                return ZipType.getEntryBuffer(name, size, allocate, deallocate);
+            }
+
+            inline XLZipEntryStream openEntryStream(const std::string& name) override {
+                return ZipType.openEntryStream(name);
+            }
+
+            inline XLZipEntrySink openEntrySink(const std::string& name, int compressionLevel) override {
+                return ZipType.openEntrySink(name, compressionLevel);
+            }
+
+            inline void prefetchEntries(const std::vector<std::string>& names, unsigned threadCount) override {
+                ZipType.prefetchEntries(names, threadCount);
+            }
+
         private:
             T ZipType;
         };
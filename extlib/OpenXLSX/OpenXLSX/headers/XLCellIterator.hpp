@@ -53,11 +53,14 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #endif // _MSC_VER
 
 #include <algorithm>
+#include <utility>
+#include <vector>
 
 #include "OpenXLSX-Exports.hpp"
 #include "XLCell.hpp"
 #include "XLCellReference.hpp"
 #include "XLIterator.hpp"
+#include "XLRowIndex.hpp"
 #include "XLXmlParser.hpp"
 
 namespace OpenXLSX
@@ -66,9 +69,10 @@ namespace OpenXLSX
      * @brief locate the XML row node within sheetDataNode for the row at rowNumber
      * @param sheetDataNode the XML sheetData node to search in
      * @param rowNumber the number of the row to locate
+     * @param rowIndex @optional the row index of the worksheet, to avoid a linear search
      * @return the XMLNode pointing to the row, or an empty XMLNode if the row does not exist
      */
-    XMLNode findRowNode(XMLNode sheetDataNode, uint32_t rowNumber);
+    XMLNode findRowNode(XMLNode sheetDataNode, uint32_t rowNumber, XLRowIndex* rowIndex = nullptr);
 
     /**
      * @brief locate the XML cell node within rownode for the cell at columnNumber
@@ -137,6 +141,13 @@ namespace OpenXLSX
          */
         void updateCurrentCell(bool createIfMissing);
 
+        /**
+         * @brief locate (or insert) the row node for m_currentRow and cache the column numbers of its cells within the range
+         * @param createIfMissing the row node will only be inserted if createIfMissing is true
+         * @note the row is located by searching forwards from m_hintNode, so the rows of the range are scanned only once
+         */
+        void loadRow(bool createIfMissing);
+
     public:     // ===== Switch back to public methods
         /**
          * @brief
@@ -209,8 +220,13 @@ namespace OpenXLSX
         XLCellReference          m_bottomRight;          /**< The cell reference of the last cell in the range */
         XLSharedStringsRef       m_sharedStrings;        /**< */
         bool                     m_endReached;           /**< */
-        XMLNode                  m_hintNode;             /**< The cell node of the last existing cell found up to current iterator position */
-        uint32_t                 m_hintRow;              /**<   the row number for m_hintCell */
+        XMLNode                  m_hintNode;             /**< The row node of the last existing row found up to current iterator position */
+        uint32_t                 m_hintRow;              /**<   the row number for m_hintNode */
+        uint32_t                 m_cachedRow;            /**< The row number for which m_rowCells is valid, 0 if no row has been loaded */
+        XMLNode                  m_cachedRowNode;        /**<   the row node of m_cachedRow, an empty node if the row does not exist */
+        std::vector<std::pair<uint16_t, XMLNode>> m_rowCells; /**<   column number and node of each cell of m_cachedRow within the range */
+        XMLNode                  m_rowTail;              /**<   the first cell node beyond the range in m_cachedRow, before which missing cells are inserted */
+        size_t                   m_rowCursor;            /**<   position in m_rowCells of the first cell at or after m_currentColumn */
         XLCell                   m_currentCell;          /**< The cell to which the iterator is currently pointing, if it exists, otherwise an empty XLCell */
         static constexpr const int XLNotLoaded  = 0;    // code readability for m_currentCellStatus
         static constexpr const int XLNoSuchCell = 1;    //   "
@@ -59,6 +59,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 
 // ===== OpenXLSX Includes ===== //
 #include "OpenXLSX-Exports.hpp"
+#include "XLConstants.hpp"
 
 namespace OpenXLSX
 {
@@ -246,6 +247,23 @@ namespace OpenXLSX
          */
         static XLCoordinates coordinatesFromAddress(const std::string& address);
 
+        /**
+         * @brief Static helper function to get the column number from the letters at the start of a cell address
+         * (e.g. 'AB12' gives 28), without constructing an XLCellReference or any string. Intended for the r attribute
+         * of cell nodes, in loops that visit many cells.
+         * @param address The zero-terminated address, e.g. 'AB12'
+         * @return The column number, or 0 if the address does not start with a valid column
+         */
+        static uint16_t columnFromAddress(const char* address)
+        {
+            uint32_t column = 0;
+            for (; *address >= 'A' && *address <= 'Z'; ++address) {
+                column = column * 26 + static_cast<uint32_t>(*address - 'A' + 1);
+                if (column > MAX_COLS) return 0;
+            }
+            return static_cast<uint16_t>(column);
+        }
+
         //----------------------------------------------------------------------------------------------------------------------
         //           Private Member Variables
         //----------------------------------------------------------------------------------------------------------------------
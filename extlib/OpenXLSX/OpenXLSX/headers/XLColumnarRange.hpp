@@ -0,0 +1,192 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+
+#ifndef OPENXLSX_XLCOLUMNARRANGE_HPP
+#define OPENXLSX_XLCOLUMNARRANGE_HPP
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#   pragma warning(disable : 4275)
+#endif // _MSC_VER
+
+// ===== External Includes ===== //
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// ===== OpenXLSX Includes ===== //
+#include "OpenXLSX-Exports.hpp"
+#include "XLRowIndex.hpp"
+#include "XLSharedStrings.hpp"
+#include "XLXmlParser.hpp"
+
+namespace OpenXLSX
+{
+    /**
+     * @brief The storage type of a column of an XLColumnarRange, determined by the values found in the column. Booleans
+     * and integers are widened to floats, and all of them to strings, as soon as a value of the wider type is found.
+     */
+    enum class XLColumnType : uint8_t {
+        Empty,      /**< No cell of the column has a value - no buffer is populated */
+        Boolean,    /**< All values are booleans, stored as 0 and 1 in integers */
+        Integer,    /**< All values are integers or booleans, stored in integers */
+        Float,      /**< All values are numbers or booleans and at least one is not an integer, stored in floats */
+        String      /**< At least one value is a string - numbers are stored as their text, booleans as 1 and 0 */
+    };
+
+    /**
+     * @brief One column of an XLColumnarRange. Only the buffers for the column type are populated, with one entry per row
+     * of the range, so that the values of a numeric column form a contiguous array. Entries of cells without a value
+     * (empty cells, missing cells and error values) are zero and their validity bit is cleared.
+     */
+    struct OPENXLSX_EXPORT XLColumnarColumn
+    {
+        XLColumnType          type { XLColumnType::Empty };
+        std::vector<uint64_t> validity {};               /**< Bit (row % 64) of word (row / 64) is set if the cell in row has a value */
+        std::vector<int64_t>  integers {};               /**< The values of a Boolean or Integer column */
+        std::vector<double>   floats {};                 /**< The values of a Float column */
+        std::vector<uint64_t> stringOffsets {};          /**< For a String column: the offset of each value in the string arena */
+        std::vector<uint32_t> stringLengths {};          /**< For a String column: the length of each value in the string arena */
+        std::vector<int32_t>  sharedStringIndices {};    /**< For a String column: the shared string index of each value, or -1 */
+
+        /**
+         * @brief Test whether the cell in a row of the range has a value
+         * @param row the 0-based row within the range
+         */
+        bool isValid(uint32_t row) const { return (validity[row / 64] >> (row % 64)) & 1; }
+    };
+
+    /**
+     * @brief The XLColumnarRange class holds the values of a rectangular range of a worksheet in per-column typed
+     * buffers, for consumers that aggregate over columns. The range is read in a single pass over the row and cell nodes
+     * of the worksheet XML, without constructing XLCell or XLCellValue objects.
+     * @details All strings of the range are stored once in a common arena: cells that refer to the same shared string
+     * refer to the same characters of the arena, and keep the shared string index so that they can be compared or
+     * grouped without looking at the characters. An XLColumnarRange is obtained from XLWorksheet::columnarRange and does
+     * not refer to the worksheet once constructed.
+     */
+    class OPENXLSX_EXPORT XLColumnarRange
+    {
+        friend class XLWorksheet;
+
+    public:
+        /**
+         * @brief Construct an empty range without rows or columns
+         */
+        XLColumnarRange() = default;
+
+        /**
+         * @brief Get the first row of the range
+         */
+        uint32_t firstRow() const { return m_firstRow; }
+
+        /**
+         * @brief Get the first column of the range
+         */
+        uint16_t firstColumn() const { return m_firstColumn; }
+
+        /**
+         * @brief Get the number of rows of the range, which is the number of entries in each column buffer
+         */
+        uint32_t rowCount() const { return m_rowCount; }
+
+        /**
+         * @brief Get the number of columns of the range
+         */
+        uint16_t columnCount() const { return static_cast<uint16_t>(m_columns.size()); }
+
+        /**
+         * @brief Get a column of the range
+         * @param index the 0-based column within the range
+         * @return the column
+         * @throws XLInputError if index is not less than columnCount()
+         */
+        const XLColumnarColumn& column(uint16_t index) const;
+
+        /**
+         * @brief Get the string value of a cell of a String column
+         * @param column the 0-based column within the range
+         * @param row the 0-based row within the range
+         * @return a view into the string arena, or an empty view if the column is not a String column
+         */
+        std::string_view stringValue(uint16_t column, uint32_t row) const;
+
+        /**
+         * @brief Get the arena that holds the characters of all strings of the range
+         */
+        const std::string& stringArena() const { return m_stringArena; }
+
+    private:
+        /**
+         * @brief Read a range of a worksheet
+         * @param sheetDataNode the sheetData node of the worksheet
+         * @param rowIndex the row index of the worksheet, used to locate the first row of the range
+         * @param sharedStrings the shared strings of the document
+         * @param firstRow, firstColumn, lastRow, lastColumn the bounds of the range
+         */
+        XLColumnarRange(XMLNode sheetDataNode, XLRowIndex* rowIndex, const XLSharedStrings& sharedStrings,
+                        uint32_t firstRow, uint16_t firstColumn, uint32_t lastRow, uint16_t lastColumn);
+
+        /**
+         * @brief Widen a column to a new type, converting the values stored so far
+         */
+        void widen(XLColumnarColumn& column, XLColumnType type);
+
+        uint32_t                      m_firstRow { 0 };
+        uint16_t                      m_firstColumn { 0 };
+        uint32_t                      m_rowCount { 0 };
+        std::vector<XLColumnarColumn> m_columns {};
+        std::string                   m_stringArena {};
+    };
+}    // namespace OpenXLSX
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(pop)
+#endif // _MSC_VER
+
+#endif    // OPENXLSX_XLCOLUMNARRANGE_HPP
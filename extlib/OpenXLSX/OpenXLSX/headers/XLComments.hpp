@@ -48,7 +48,10 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 
 // ===== External Includes ===== //
 #include <cstdint>    // uint8_t, uint16_t, uint32_t
+#include <map>        // std::map
 #include <ostream>    // std::basic_ostream
+#include <string>     // std::string
+#include <vector>     // std::vector
 
 // ===== OpenXLSX Includes ===== //
 #include "OpenXLSX-Exports.hpp"
@@ -141,8 +144,21 @@ namespace OpenXLSX
         std::unique_ptr<XMLNode> m_commentNode;      /**< An XMLNode object with the comment item */
      };
 
+    /**
+     * @brief A comment to be set for a cell through XLComments::set(const std::vector<XLCommentEntry>&)
+     */
+    struct XLCommentEntry
+    {
+        std::string ref;          /**< the cell address of the comment */
+        std::string text;         /**< the comment text */
+        uint16_t    authorId{0};  /**< the index of the comment author */
+    };
+
     /**
      * @brief The XLComments class is the base class for worksheet comments
+     * @note Comment nodes are indexed by cell position on first lookup. The index is maintained by set and deleteComment, but
+     *  not by modifications of the same comments XML through other XLComments objects - as with m_hintNode, only one object
+     *  should be used to modify the comments of a worksheet.
      */
     class OPENXLSX_EXPORT XLComments : public XLXmlFile
     {
@@ -201,6 +217,9 @@ namespace OpenXLSX
         XMLNode authorNode(uint16_t index) const;
         XMLNode commentNode(size_t index) const;
         XMLNode commentNode(const std::string& cellRef) const;
+        void buildIndex() const;
+        XMLNode insertCommentNode(uint32_t row, uint16_t column, bool& created);
+        XMLNode shapeNodeIndexed(uint32_t row, uint16_t column, std::map<uint64_t, XMLNode>& shapeIndex, bool& shapesIndexed) const;
 
     public:
 
@@ -245,6 +264,16 @@ namespace OpenXLSX
          */
         bool set(std::string const& cellRef, std::string const& comment, uint16_t authorId_ = 0);
 
+        /**
+         * @brief set the comments for several cells in one pass
+         * @param comments the comments to set - if a cell is listed more than once, the last entry for it is used
+         * @return true upon success
+         * @throws XLException if any cell address is invalid, in which case no comment is modified
+         * @note new comments and their shapes are inserted in cell order, so that appending comments behind the last existing
+         *  one does not need to search the comment list
+         */
+        bool set(std::vector<XLCommentEntry> const& comments);
+
         /**
          * @brief get the XLShape object for this comment
          */
@@ -261,6 +290,8 @@ namespace OpenXLSX
         std::unique_ptr<XLVmlDrawing> m_vmlDrawing;
         mutable XMLNode m_hintNode{};                 // the last comment XML Node accessed by index is stored here, if any - will be reset when comments are inserted or deleted
         mutable size_t m_hintIndex{0};                // this has the index at which m_hintNode was accessed, only valid if not m_hintNode.empty()
+        mutable std::map<uint64_t, XMLNode> m_index{}; // comment nodes by cell position (row << 16 | column), only valid if m_indexValid
+        mutable bool m_indexValid{false};             // the index is built on first use, as most comments objects are never searched
         inline static const std::vector< std::string_view > m_nodeOrder = {      // comments XML node required child sequence
             "authors",
             "commentList"
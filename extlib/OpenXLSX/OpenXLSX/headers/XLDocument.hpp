@@ -56,6 +56,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #include <algorithm> // std::find_if
 #include <list>
 #include <string>
+#include <unordered_map>
 
 // ===== OpenXLSX Includes ===== //
 #include "IZipArchive.hpp"
@@ -80,6 +81,15 @@ namespace OpenXLSX
     constexpr const bool XLForceOverwrite = true;    // readability constant for 2nd parameter of XLDocument::saveAs
     constexpr const bool XLDoNotOverwrite = false;   //  "
 
+    /**
+     * @brief Options that control how XLDocument::open loads the parts of a workbook.
+     */
+    struct XLOpenOptions
+    {
+        bool     parseWorksheets { false }; /**< Parse all worksheets on open, concurrently, instead of each on first access. >*/
+        unsigned threadCount { 0 };         /**< Number of threads used to parse worksheets; 0 uses all hardware threads. >*/
+    };
+
     /**
      * @brief The XLDocumentProperties class is an enumeration of the possible properties (metadata) that can be set
      * for a XLDocument object (and .xlsx file)
@@ -180,8 +190,9 @@ namespace OpenXLSX
         /**
          * @brief Open the .xlsx file with the given path
          * @param fileName The path of the .xlsx file to open
+         * @param options @optional whether to parse all worksheets up front, and on how many threads
          */
-        void open(const std::string& fileName);
+        void open(const std::string& fileName, const XLOpenOptions& options = XLOpenOptions{});
 
         /**
          * @brief Create a new .xlsx file with the given name.
@@ -207,19 +218,21 @@ namespace OpenXLSX
 
         /**
          * @brief Save the current document using the current filename, overwriting the existing file.
+         * @param options @optional the compression level and number of compression threads
          * @throw XLException (OpenXLSX failed checks)
          * @throw ZipRuntimeError (zippy failed archive / file access)
          */
-        void save();
+        void save(const XLZipSaveOptions& options = XLZipSaveOptions{});
 
         /**
          * @brief Save the document with a new name. If a file exists with that name, it will be overwritten.
          * @param fileName The path of the file
          * @param forceOverwrite If not true (XLForceOverwrite) and fileName exists, saveAs will throw an exception
+         * @param options @optional the compression level and number of compression threads
          * @throw XLException (OpenXLSX failed checks)
          * @throw ZipRuntimeError (zippy failed archive / file access)
          */
-        void saveAs(const std::string& fileName, bool forceOverwrite);
+        void saveAs(const std::string& fileName, bool forceOverwrite, const XLZipSaveOptions& options = XLZipSaveOptions{});
 
         /**
          * @brief Save the document with a new name. Legacy interface, invokes saveAs( fileName, XLForceOverwrite )
@@ -398,11 +411,12 @@ namespace OpenXLSX
 
     protected:
         /**
-         * @brief Get an XML file from the .xlsx archive.
+         * @brief Parse an XML file from the .xlsx archive into the given document.
+         * @details The file is decompressed into a buffer that is handed over to the document and parsed in place.
          * @param path The relative path of the file.
-         * @return A std::string with the content of the file
+         * @param xmlDocument The document to load; it is left empty if the file does not exist.
          */
-        std::string extractXmlFromArchive(const std::string& path);
+        void extractXmlFromArchive(const std::string& path, XMLDocument& xmlDocument);
 
         /**
          * @brief fetch the XLXmlData object as stored in m_data, throw XLInternalError if path is not found
@@ -427,6 +441,27 @@ namespace OpenXLSX
          */
         bool hasXmlData(const std::string& path) const;
 
+        /**
+         * @brief Add an XLXmlData object for an XML file to m_data and to the index of m_data by path
+         * @param path The relative path of the file.
+         * @param xmlId The relationship ID of the file, if any
+         * @param xmlType The type of object the XML file represents
+         * @return A reference to the new XLXmlData object
+         */
+        XLXmlData& addXmlData(const std::string& path, const std::string& xmlId = "", XLContentType xmlType = XLContentType::Unknown);
+
+        /**
+         * @brief Remove the XLXmlData object for an XML file from m_data and from the index of m_data, if it exists
+         * @param path The relative path of the file.
+         */
+        void eraseXmlData(const std::string& path);
+
+        /**
+         * @brief Decompress and parse all worksheet parts on up to threadCount threads
+         * @param threadCount The maximum number of threads to use; 0 uses all hardware threads
+         */
+        void parseWorksheets(unsigned threadCount);
+
         //----------------------------------------------------------------------------------------------------------------------
         //           Private Member Variables
         //----------------------------------------------------------------------------------------------------------------------
@@ -439,7 +474,9 @@ namespace OpenXLSX
         XLXmlSavingDeclaration m_xmlSavingDeclaration;  /**< The xml saving declaration that will be passed to pugixml before generating the XML output data*/
 
         mutable std::list<XLXmlData>    m_data {};              /**<  */
+        std::unordered_map<std::string, std::list<XLXmlData>::iterator> m_dataIndex {}; /**< hash index into m_data by XML path */
         mutable std::deque<std::string> m_sharedStringCache {}; /**<  */
+        mutable XLSharedStringIndex     m_sharedStringIndex {}; /**< hash index into m_sharedStringCache */
         mutable XLSharedStrings         m_sharedStrings {};     /**<  */
 
         XLRelationships m_docRelationships {}; /**< A pointer to the document relationships object*/
@@ -54,6 +54,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 
 #include <deque>
 #include <limits>     // std::numeric_limits
+#include <map>        // std::map, std::multimap
 #include <memory>     // std::unique_ptr
 #include <ostream>    // std::basic_ostream
 #include <string>
@@ -78,6 +79,8 @@ namespace OpenXLSX
      * (empty) <mergeCell> elements within that array, with a sole attribute ref="..." with ... being a range reference, e.g. A1:B5
      * Unfortunately, since an empty <mergeCells> element is not allowed, the class must have access to the worksheet root node and
      *  delete the <mergeCells> element each time the merge count is zero
+     * @note Alongside the XML, the merged ranges are kept as numeric rectangles in an index of row buckets, so that the overlap
+     *  test of appendMerge and the lookups of findMerge and findMergeByCell do not scan and parse all references
      */
     class OPENXLSX_EXPORT XLMergeCells
     {
@@ -183,6 +186,15 @@ namespace OpenXLSX
          */
         XLMergeIndex appendMerge(const std::string& reference);
 
+        /**
+         * @brief Append several merges to the list of merges. Either all merges are appended, or none.
+         * @param references The references to append, which must not overlap with each other
+         * @return An XLMergeIndex with the index of the first appended merge
+         * @throws XLInputException if a reference is invalid or would overlap with an existing reference or with another
+         *  reference in references
+         */
+        XLMergeIndex appendMerges(const std::vector<std::string>& references);
+
         /**
          * @brief Delete the merge at the given index.
          * @param index The index to delete
@@ -202,10 +214,65 @@ namespace OpenXLSX
         void print(std::basic_ostream<char>& ostr) const;
 
     private:
+        /**
+         * @brief The cells of a merged range
+         * @note A merge whose reference can not be parsed is kept in the XML with a topRow of 0, and is not indexed
+         */
+        struct XLMergeRect
+        {
+            uint32_t topRow;
+            uint32_t bottomRow;
+            uint16_t firstCol;
+            uint16_t lastCol;
+        };
+
+        /**
+         * @brief The merges that intersect a bucket of consecutive rows, by first column
+         */
+        struct XLMergeBucket
+        {
+            std::multimap<uint16_t, XLMergeIndex> byFirstCol;
+            uint16_t                              maxWidth { 0 };    /**< The largest lastCol - firstCol of the merges in the bucket */
+        };
+
+        /**
+         * @brief Parse a range reference of a merge
+         * @throws XLInputError if reference is not a valid range reference of at least 2 cells
+         */
+        static XLMergeRect parseReference(const std::string& reference);
+
+        /**
+         * @brief Find a merge that overlaps with rect
+         * @return the index of the merge, or XLMergeNotFound
+         */
+        XLMergeIndex findOverlap(const XLMergeRect& rect) const;
+
+        /**
+         * @brief Add the merge at index to the row buckets that it intersects. A merge with an unparseable reference is skipped.
+         */
+        void indexMerge(XLMergeIndex index);
+
+        /**
+         * @brief Remove the merge at index from the row buckets that it intersects
+         */
+        void unindexMerge(XLMergeIndex index);
+
+        /**
+         * @brief Append a mergeCell element with the given reference to the XML and the reference cache
+         */
+        void appendNode(const std::string& reference);
+
+        /**
+         * @brief Update the count attribute of the mergeCells element
+         */
+        void updateCount();
+
         std::unique_ptr<XMLNode> m_rootNode;         /**< An XMLNode object with the worksheet root node (document element) */
         std::vector< std::string_view > m_nodeOrder; /**< worksheet XML root node required child sequence as passed into constructor */
         std::unique_ptr<XMLNode> m_mergeCellsNode; /**< An XMLNode object with the mergeCells item */
         std::deque<std::string> m_referenceCache;
+        std::vector<XLMergeRect> m_rects;                  /**< The rectangle of each merge, by merge index */
+        std::map<uint32_t, XLMergeBucket> m_rowBuckets;    /**< The index of the merges, by (row - 1) / mergeBucketRows */
     };
 }    // namespace OpenXLSX
 
@@ -0,0 +1,141 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+
+
+#ifndef OPENXLSX_XLNODEINDEX_HPP
+#define OPENXLSX_XLNODEINDEX_HPP
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#   pragma warning(disable : 4275)
+#endif // _MSC_VER
+
+// ===== External Includes ===== //
+#include <string>
+#include <unordered_map>
+
+// ===== OpenXLSX Includes ===== //
+#include "OpenXLSX-Exports.hpp"
+#include "XLXmlParser.hpp"
+
+namespace OpenXLSX
+{
+    /**
+     * @brief The XLNodeIndex class maps the values of one attribute (e.g. the "name" of a sheet, or the "Id" of a
+     * relationship) to the element children of a parent node that carry them, so that looking up a child by that
+     * attribute does not require walking the sibling list. The index is built lazily on first use.
+     * @note Element children appended to the parent node without going through the index are picked up by the next
+     * lookup. Children must however only be removed, or have their attribute changed, after calling eraseNode, as the
+     * index would otherwise keep a dangling node.
+     */
+    class OPENXLSX_EXPORT XLNodeIndex
+    {
+    public:
+        /**
+         * @brief Constructor. The index is empty until the first lookup.
+         * @param attributeName the name of the attribute to index the children by
+         */
+        explicit XLNodeIndex(std::string attributeName);
+
+        /**
+         * @brief Get the name of the attribute that the children are indexed by
+         * @return the attribute name
+         */
+        const std::string& attributeName() const;
+
+        /**
+         * @brief Locate the first element child of parentNode whose attribute has the value key
+         * @param parentNode the XML node whose children to search
+         * @param key the attribute value to look up
+         * @return the XMLNode pointing to the child, or an empty XMLNode if no child has that attribute value
+         */
+        XMLNode findNode(XMLNode parentNode, const std::string& key);
+
+        /**
+         * @brief Add node to the index under its current attribute value. Must be called after the attribute of an
+         * indexed node was changed; nodes that were appended to the parent node are picked up without this call.
+         * @param node an element child of the parent node the index was built for
+         */
+        void insertNode(XMLNode node);
+
+        /**
+         * @brief Remove node from the index. Must be called before node is removed from its parent, or before its
+         * attribute is changed.
+         * @param node an element child of the parent node the index was built for
+         */
+        void eraseNode(XMLNode node);
+
+        /**
+         * @brief Discard the index, e.g. when the underlying XML document is replaced. It will be rebuilt on next use.
+         */
+        void invalidate();
+
+    private:
+        /**
+         * @brief Rebuild the index from scratch by scanning all element children of parentNode
+         */
+        void rebuild(XMLNode parentNode);
+
+        /**
+         * @brief Add the element children that were appended after m_lastNode, rebuilding the index if m_lastNode is no
+         * longer found among the children of m_parentNode
+         */
+        void absorbAppendedNodes();
+
+        std::string                              m_attributeName {}; /**< The name of the indexed attribute */
+        XMLNode                                  m_parentNode {};    /**< The node whose children are indexed */
+        XMLNode                                  m_lastNode {};      /**< The last element child seen by the index */
+        std::unordered_map<std::string, XMLNode> m_nodes {};         /**< Attribute values and the nodes carrying them */
+        bool                                     m_valid { false };  /**< Whether m_nodes reflects m_parentNode */
+    };
+}    // namespace OpenXLSX
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(pop)
+#endif // _MSC_VER
+
+#endif    // OPENXLSX_XLNODEINDEX_HPP
@@ -0,0 +1,134 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+
+#ifndef OPENXLSX_XLNUMBERCODEC_HPP
+#define OPENXLSX_XLNUMBERCODEC_HPP
+
+// ===== External Includes ===== //
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// ===== OpenXLSX Includes ===== //
+#include "OpenXLSX-Exports.hpp"
+
+namespace OpenXLSX
+{
+    /**
+     * @brief The size of a buffer that is large enough for any number formatted by formatInteger or formatFloat.
+     */
+    constexpr size_t XLNumberBufferSize = 32;
+
+    /**
+     * @brief Format an integer the way it is stored in a cell value node.
+     * @param value The integer to format.
+     * @param first The beginning of the output buffer, which must hold at least XLNumberBufferSize characters.
+     * @return A pointer one past the last character written. No terminating zero is written.
+     */
+    OPENXLSX_EXPORT char* formatInteger(int64_t value, char* first);
+
+    /**
+     * @brief Format a floating point number as the shortest text that parses back to the same value, e.g. 0.1 is
+     * formatted as "0.1" rather than "0.10000000000000001". Whole numbers are formatted without a decimal point.
+     * @note If the standard library has no floating point std::to_chars, the text has 15 or 17 significant digits,
+     * whichever round-trips first.
+     * @param value The number to format.
+     * @param first The beginning of the output buffer, which must hold at least XLNumberBufferSize characters.
+     * @return A pointer one past the last character written. No terminating zero is written.
+     */
+    OPENXLSX_EXPORT char* formatFloat(double value, char* first);
+
+    /**
+     * @brief Format a floating point number as the shortest text that parses back to the same value.
+     * @param value The number to format.
+     * @return The formatted number.
+     */
+    OPENXLSX_EXPORT std::string formatFloat(double value);
+
+    /**
+     * @brief Parse an optionally negative integer, which must span the whole text.
+     * @param first The beginning of the text.
+     * @param last The end of the text.
+     * @param value Receives the parsed value on success.
+     * @return false if the text is not an integer, or if it does not fit an int64_t.
+     */
+    OPENXLSX_EXPORT bool parseInteger(const char* first, const char* last, int64_t& value);
+
+    /**
+     * @brief Parse a floating point number in plain or scientific notation, which must span the whole text.
+     * @param first The beginning of the text.
+     * @param last The end of the text.
+     * @param value Receives the parsed value on success.
+     * @return false if the text is not a number.
+     */
+    OPENXLSX_EXPORT bool parseFloat(const char* first, const char* last, double& value);
+
+    /**
+     * @brief Determine whether the text of a numeric cell value holds a floating point number rather than an integer.
+     * @param first The beginning of the text.
+     * @param last The end of the text.
+     * @return true if the text contains a decimal point or an exponent.
+     */
+    OPENXLSX_EXPORT bool isFloatText(const char* first, const char* last);
+
+    /**
+     * @brief Convert the text of a numeric cell value to an integer. Text that parseInteger rejects is converted
+     * leniently (leading whitespace, trailing garbage), the same way as pugixml's as_llong.
+     * @param text The zero-terminated text.
+     * @return The converted value.
+     */
+    OPENXLSX_EXPORT int64_t textToInteger(const char* text);
+
+    /**
+     * @brief Convert the text of a numeric cell value to a floating point number. Text that parseFloat rejects is
+     * converted leniently, the same way as pugixml's as_double.
+     * @param text The zero-terminated text.
+     * @return The converted value.
+     */
+    OPENXLSX_EXPORT double textToFloat(const char* text);
+}    // namespace OpenXLSX
+
+#endif    // OPENXLSX_XLNUMBERCODEC_HPP
@@ -55,6 +55,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 // ===== OpenXLSX Includes ===== //
 #include "OpenXLSX-Exports.hpp"
 #include "XLRowData.hpp"
+#include "XLRowIndex.hpp"
 
 // ========== CLASS AND ENUM TYPE DEFINITIONS ========== //
 namespace OpenXLSX
@@ -399,6 +400,7 @@ namespace OpenXLSX
         uint32_t                 m_lastRow { 1 };  /**< The cell reference of the last cell in the range */
         XLRow                    m_currentRow;     /**< */
         XLSharedStringsRef       m_sharedStrings;  /**< */
+        XLRowIndex*              m_rowIndex;       /**< Row index of the worksheet, may be nullptr */
 
         // helper variables for non-creating iterator functionality
         bool                     m_endReached;           /**< */
@@ -429,8 +431,13 @@ namespace OpenXLSX
          * @param first
          * @param last
          * @param sharedStrings
+         * @param rowIndex @optional the row index of the worksheet, used by iterators to locate the first existing row
          */
-        explicit XLRowRange(const XMLNode& dataNode, uint32_t first, uint32_t last, const XLSharedStrings& sharedStrings);
+        explicit XLRowRange(const XMLNode&         dataNode,
+                            uint32_t               first,
+                            uint32_t               last,
+                            const XLSharedStrings& sharedStrings,
+                            XLRowIndex*            rowIndex = nullptr);
 
         /**
          * @brief
@@ -490,6 +497,7 @@ namespace OpenXLSX
         uint32_t                 m_firstRow;      /**< The cell reference of the first cell in the range */
         uint32_t                 m_lastRow;       /**< The cell reference of the last cell in the range */
         XLSharedStringsRef       m_sharedStrings; /**< */
+        XLRowIndex*              m_rowIndex;      /**< Row index of the worksheet, may be nullptr */
     };
 
 }    // namespace OpenXLSX
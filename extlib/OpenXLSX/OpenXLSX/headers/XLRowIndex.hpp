@@ -0,0 +1,143 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+
+#ifndef OPENXLSX_XLROWINDEX_HPP
+#define OPENXLSX_XLROWINDEX_HPP
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#   pragma warning(disable : 4275)
+#endif // _MSC_VER
+
+// ===== External Includes ===== //
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// ===== OpenXLSX Includes ===== //
+#include "OpenXLSX-Exports.hpp"
+#include "XLXmlParser.hpp"
+
+namespace OpenXLSX
+{
+    /**
+     * @brief The XLRowIndex class maps row numbers to the row nodes of a worksheet's sheetData node, so that random
+     * access to a row does not require walking the sibling list. The index is built lazily on first use and is kept
+     * sorted by row number.
+     * @note Rows inserted into sheetData without going through the index (e.g. by XLCellIterator or XLRowIterator)
+     * are picked up the next time a lookup lands next to them. Rows must however only be removed after calling
+     * eraseRow, as the index would otherwise keep a dangling node.
+     */
+    class OPENXLSX_EXPORT XLRowIndex
+    {
+    public:
+        /**
+         * @brief Default constructor. The index is empty until the first lookup.
+         */
+        XLRowIndex() = default;
+
+        /**
+         * @brief Locate the row node for rowNumber
+         * @param sheetDataNode the XML sheetData node to search in
+         * @param rowNumber the number of the row to locate
+         * @return the XMLNode pointing to the row, or an empty XMLNode if the row does not exist
+         */
+        XMLNode findRowNode(XMLNode sheetDataNode, uint32_t rowNumber);
+
+        /**
+         * @brief Locate the first row node with a row number of at least rowNumber
+         * @param sheetDataNode the XML sheetData node to search in
+         * @param rowNumber the number of the first row of interest
+         * @return the XMLNode pointing to the row, or an empty XMLNode if no row from rowNumber on exists
+         */
+        XMLNode findRowNodeAtOrAfter(XMLNode sheetDataNode, uint32_t rowNumber);
+
+        /**
+         * @brief Locate the row node for rowNumber, inserting a new row node at the correct position if it does not exist
+         * @param sheetDataNode the XML sheetData node to search in
+         * @param rowNumber the number of the row to locate
+         * @return the XMLNode pointing to the row
+         */
+        XMLNode getRowNode(XMLNode sheetDataNode, uint32_t rowNumber);
+
+        /**
+         * @brief Remove rowNumber from the index. Must be called before the row node is removed from sheetData.
+         * @param rowNumber the number of the row that is about to be deleted
+         */
+        void eraseRow(uint32_t rowNumber);
+
+        /**
+         * @brief Discard the index, e.g. when the underlying XML document is replaced. It will be rebuilt on next use.
+         */
+        void invalidate();
+
+    private:
+        using XLRowEntry = std::pair<uint32_t, XMLNode>;
+
+        /**
+         * @brief Find the position of rowNumber in m_rows, after making sure that the index is built for sheetDataNode
+         * and that no row nodes exist in the XML between the neighbours of that position
+         * @return an iterator to the entry for rowNumber, or to the position where it would have to be inserted
+         */
+        std::vector<XLRowEntry>::iterator locate(XMLNode sheetDataNode, uint32_t rowNumber);
+
+        /**
+         * @brief Rebuild the index from scratch by scanning all row nodes of sheetDataNode
+         */
+        void rebuild(XMLNode sheetDataNode);
+
+        XMLNode                 m_sheetDataNode {}; /**< The sheetData node that the index was built for */
+        std::vector<XLRowEntry> m_rows {};          /**< Row numbers and nodes, sorted by row number */
+        bool                    m_valid { false };  /**< Whether m_rows reflects m_sheetDataNode */
+    };
+}    // namespace OpenXLSX
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(pop)
+#endif // _MSC_VER
+
+#endif    // OPENXLSX_XLROWINDEX_HPP
@@ -67,6 +67,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #include "XLCellReference.hpp"
 #include "XLColor.hpp"
 #include "XLColumn.hpp"
+#include "XLColumnarRange.hpp"
 #include "XLCommandQuery.hpp"
 #include "XLComments.hpp" // XLComments
 #include "XLDocument.hpp"
@@ -970,6 +971,15 @@ namespace OpenXLSX
          */
         XLCellRange range(const XLCellReference& topLeft, const XLCellReference& bottomRight) const;
 
+        /**
+         * @brief Read the values of a range into per-column typed buffers, in a single pass over the worksheet XML.
+         * @param topLeft An XLCellReference object with the coordinates to the top left cell.
+         * @param bottomRight An XLCellReference object with the coordinates to the bottom right cell.
+         * @return An XLColumnarRange object with the values of the range.
+         * @throws XLInputError if bottomRight is above or left of topLeft
+         */
+        XLColumnarRange columnarRange(const XLCellReference& topLeft, const XLCellReference& bottomRight) const;
+
         /**
          * @brief Get a range with the given coordinates.
          * @param topLeft A std::string that is convertible to an XLCellReference to the top left cell
@@ -1036,7 +1046,7 @@ namespace OpenXLSX
 
         /**
          * @brief Get the number of columns in the worksheet.
-         * @return The number of columns.
+         * @return The number of columns, i.e. the last column of usedRange(), or 0 if the worksheet has no cells.
          */
         uint16_t columnCount() const noexcept;
 
@@ -1046,6 +1056,13 @@ namespace OpenXLSX
          */
         uint32_t rowCount() const noexcept;
 
+        /**
+         * @brief Get the used range of the worksheet, i.e. the smallest range that contains all cells of the worksheet.
+         * @return The used range, as kept in the <dimension> element. For a worksheet without cells, this is A1:A1 and columnCount() is 0.
+         * @note The used range is maintained as cells are created and rows are deleted, so this does not scan the worksheet.
+         */
+        XLCellRange usedRange() const;
+
         /**
          * @brief Delete the row with the given row number from the underlying OOXML.
          * @return true if a row entry existed in OOXML & was deleted, otherwise false
@@ -0,0 +1,220 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+
+#ifndef OPENXLSX_XLSTREAMREADER_HPP
+#define OPENXLSX_XLSTREAMREADER_HPP
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#   pragma warning(disable : 4275)
+#endif // _MSC_VER
+
+// ===== External Includes ===== //
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// ===== OpenXLSX Includes ===== //
+#include "IZipArchive.hpp"
+#include "OpenXLSX-Exports.hpp"
+#include "XLCellValue.hpp"
+#include "XLSharedStrings.hpp"
+
+namespace OpenXLSX
+{
+    /**
+     * @brief The XLStreamReader class reads the rows of a worksheet front to back, directly from the worksheet XML,
+     * without building an XML document for it. The XML is decompressed incrementally as rows are requested, so when
+     * the caller stops after the rows it needs, the remainder of the sheet is never decompressed or scanned.
+     * @details An XLStreamReader is obtained from XLWorkbook::streamWorksheet. Cell values are determined the same way
+     * as by XLCellValueProxy, including the resolution of shared strings. Formulas, styles and all other content of
+     * the worksheet are skipped.
+     * @warning A reader on a worksheet that is read from the archive must not be used after the document was saved or
+     * closed.
+     */
+    class OPENXLSX_EXPORT XLStreamReader
+    {
+        friend class XLWorkbook;
+
+    public:
+        /**
+         * @brief Move constructor
+         */
+        XLStreamReader(XLStreamReader&& other) noexcept = default;
+
+        /**
+         * @brief Move assignment operator
+         */
+        XLStreamReader& operator=(XLStreamReader&& other) noexcept = default;
+
+        XLStreamReader(const XLStreamReader& other)            = delete;
+        XLStreamReader& operator=(const XLStreamReader& other) = delete;
+
+        /**
+         * @brief Destructor
+         */
+        ~XLStreamReader() = default;
+
+        /**
+         * @brief Advance to the next row node of the worksheet. Rows that are not present in the XML are not visited.
+         * @return true if a row was read, false if the end of the sheet data was reached
+         * @throw XLInputError if the worksheet XML is malformed
+         */
+        bool nextRow();
+
+        /**
+         * @brief Get the ref attribute of the dimension element of the worksheet, which precedes the sheet data. Only the
+         * start of the worksheet XML is read for this; the rows are still available to nextRow afterwards.
+         * @return the ref as stored in the worksheet (e.g. "A1:C5"), or an empty string if the worksheet has no
+         * dimension element
+         * @note The value is taken as written by the application that saved the file; it is not checked against the cells.
+         */
+        const std::string& dimension();
+
+        /**
+         * @brief Get the number of the current row
+         * @return the row number, or 0 if nextRow has not been called yet
+         */
+        uint32_t rowNumber() const;
+
+        /**
+         * @brief Get the values of the current row
+         * @return the cell values of the current row, indexed by column number - 1, up to the last cell present in the row
+         */
+        const std::vector<XLCellValue>& values() const;
+
+    private:
+        /**
+         * @brief A start, end or empty element tag. The name and attributes point into the read buffer and remain
+         * valid until the next tag is read.
+         */
+        struct XLTag
+        {
+            enum class Kind { Start, End, Empty };
+            Kind             kind { Kind::Start };
+            std::string_view name {};       /**< The local name of the element, without namespace prefix */
+            std::string_view attributes {}; /**< The raw attribute list of a start or empty element tag */
+        };
+
+        /**
+         * @brief Construct a reader on a worksheet XML that is decompressed as it is read
+         * @param source the stream of the worksheet entry in the archive
+         * @param sharedStrings the shared strings of the document
+         */
+        XLStreamReader(XLZipEntryStream source, const XLSharedStrings& sharedStrings);
+
+        /**
+         * @brief Construct a reader on a worksheet XML held in memory
+         * @param xml the worksheet XML
+         * @param sharedStrings the shared strings of the document
+         */
+        XLStreamReader(std::string xml, const XLSharedStrings& sharedStrings);
+
+        /**
+         * @brief Read the worksheet XML up to and including the sheetData start tag, recording the dimension ref on the way.
+         * Does nothing once the sheet data was reached.
+         */
+        void readHead();
+
+        /**
+         * @brief Append the next chunk of the source to the read buffer
+         * @return false if the source is exhausted
+         */
+        bool fill();
+
+        /**
+         * @brief Find str in the read buffer at or after position from, reading more of the source as needed
+         * @return the position of str, or std::string::npos if it does not occur in the remainder of the XML
+         */
+        size_t find(std::string_view str, size_t from);
+
+        /**
+         * @brief Read up to and including the next element tag, skipping comments and processing instructions
+         * @param tag receives the tag
+         * @param text if not nullptr, the decoded character data preceding the tag is appended to it
+         * @return false if the end of the XML was reached before another tag
+         */
+        bool nextTag(XLTag& tag, std::string* text);
+
+        /**
+         * @brief Skip the content of the element whose start tag was just read, up to and including its end tag
+         */
+        void skipElement();
+
+        /**
+         * @brief Append the character data of the element whose start tag was just read to text, up to and including its
+         * end tag
+         */
+        void readText(std::string& text);
+
+        /**
+         * @brief Read the content of the cell element whose start tag was just read, and store its value
+         * @param column the column number of the cell
+         * @param type the value of the t attribute of the cell
+         * @param hasType whether the cell has a t attribute
+         */
+        void readCell(uint16_t column, const std::string& type, bool hasType);
+
+        XLZipEntryStream         m_source {};        /**< The worksheet XML stream, or empty if all XML is in m_buffer */
+        XLSharedStrings          m_sharedStrings {}; /**< Used to resolve shared string cell values */
+        std::string              m_buffer {};        /**< The part of the worksheet XML that was read but not consumed */
+        size_t                   m_position { 0 };   /**< The read position in m_buffer */
+        bool                     m_inSheetData { false };
+        bool                     m_finished { false };
+        uint32_t                 m_rowNumber { 0 };
+        std::string              m_dimension {};     /**< The ref of the dimension element, once the head was read */
+        std::vector<XLCellValue> m_values {};
+        std::string              m_text {};          /**< Scratch buffer for character data */
+    };
+}    // namespace OpenXLSX
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(pop)
+#endif // _MSC_VER
+
+#endif    // OPENXLSX_XLSTREAMREADER_HPP
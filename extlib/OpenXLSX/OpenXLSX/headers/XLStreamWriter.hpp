@@ -0,0 +1,170 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+
+
+#ifndef OPENXLSX_XLSTREAMWRITER_HPP
+#define OPENXLSX_XLSTREAMWRITER_HPP
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#   pragma warning(disable : 4275)
+#endif // _MSC_VER
+
+// ===== External Includes ===== //
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// ===== OpenXLSX Includes ===== //
+#include "IZipArchive.hpp"
+#include "OpenXLSX-Exports.hpp"
+#include "XLCellValue.hpp"
+#include "XLSharedStrings.hpp"
+
+namespace OpenXLSX
+{
+    class XLXmlData;
+
+    /**
+     * @brief The XLStreamWriter class replaces the rows of a worksheet by rows that are appended in ascending order. The
+     * row XML is serialized directly into the compressed worksheet entry of the archive, without building an XML
+     * document for it, so that the memory needed does not grow with the number of cells written.
+     * @details An XLStreamWriter is obtained from XLWorkbook::worksheetWriter. All other content of the worksheet, e.g.
+     * column formats and merged cells, is kept. String values are added to the shared strings of the document. The
+     * worksheet entry is completed by close(); the document must then be saved for the rows to be written to disk.
+     * @warning While the writer is open, and after it was closed, existing XLWorksheet objects and cell handles of the
+     * worksheet are invalid; the worksheet must be fetched from the workbook again. A writer must not be used after the
+     * document was saved or closed.
+     */
+    class OPENXLSX_EXPORT XLStreamWriter
+    {
+        friend class XLWorkbook;
+
+    public:
+        /**
+         * @brief Move constructor. The moved-from writer is closed.
+         */
+        XLStreamWriter(XLStreamWriter&& other) noexcept;
+
+        XLStreamWriter(const XLStreamWriter& other)            = delete;
+        XLStreamWriter& operator=(const XLStreamWriter& other) = delete;
+        XLStreamWriter& operator=(XLStreamWriter&& other)      = delete;
+
+        /**
+         * @brief Destructor. Closes the writer if that has not happened yet; errors are not reported, so close() should
+         * be called explicitly.
+         */
+        ~XLStreamWriter();
+
+        /**
+         * @brief Append the given values as the row following the last row written, starting at column A.
+         * @param values the cell values; empty values are not written
+         */
+        void appendRow(const std::vector<XLCellValue>& values);
+
+        /**
+         * @brief Append the given values as the row with the given number.
+         * @param rowNumber the row number, which must be greater than that of the last row written
+         * @param values the cell values; empty values are not written
+         * @param firstColumn the column number of the first value
+         * @throw XLInputError if the row number or a column number is out of order or out of bounds
+         */
+        void appendRow(uint32_t rowNumber, const std::vector<XLCellValue>& values, uint16_t firstColumn = 1);
+
+        /**
+         * @brief Get the number of the last row written
+         * @return the row number, or 0 if no row was written yet
+         */
+        uint32_t rowNumber() const;
+
+        /**
+         * @brief Write the remainder of the worksheet and complete its archive entry. Further calls have no effect.
+         */
+        void close();
+
+    private:
+        /**
+         * @brief Construct a writer and write the part of the worksheet XML before the rows
+         * @param sink the writer of the worksheet entry in the archive
+         * @param xmlData the XML data of the worksheet, which is discarded when the writer is closed
+         * @param sharedStrings the shared strings of the document
+         * @param head the worksheet XML up to and including the sheetData start tag
+         * @param tail the worksheet XML from the sheetData end tag
+         */
+        XLStreamWriter(XLZipEntrySink sink, XLXmlData* xmlData, const XLSharedStrings& sharedStrings, const std::string& head, std::string tail);
+
+        /**
+         * @brief Append a cell element to the output buffer
+         */
+        void writeCell(uint16_t column, const XLCellValue& value);
+
+        /**
+         * @brief Append str to the output buffer, escaping XML markup characters
+         */
+        void writeEscaped(const std::string& str);
+
+        /**
+         * @brief Pass the output buffer to the sink
+         */
+        void flush();
+
+        XLZipEntrySink  m_sink {};          /**< The writer of the worksheet entry, or empty once closed */
+        XLXmlData*      m_xmlData {};       /**< The XML data of the worksheet */
+        XLSharedStrings m_sharedStrings {}; /**< Used to intern string cell values */
+        std::string     m_tail {};          /**< The worksheet XML following the rows */
+        std::string     m_buffer {};        /**< Output that was not passed to the sink yet */
+        std::string     m_row {};           /**< The row number of the row being written, as text */
+        std::vector<std::string> m_columnNames {}; /**< Column letters by column number - 1, cached as they are used */
+        uint32_t        m_rowNumber { 0 };
+    };
+}    // namespace OpenXLSX
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(pop)
+#endif // _MSC_VER
+
+#endif    // OPENXLSX_XLSTREAMWRITER_HPP
@@ -56,6 +56,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #include <cstdint>   // uint32_t etc
 #include <string>
 #include <string_view>  // std::string_view
+#include <unordered_map>
 #include <vector>
 
 // ===== OpenXLSX Includes ===== //
@@ -69,6 +70,7 @@ namespace OpenXLSX
     using namespace std::literals::string_view_literals; // enables sv suffix only
 
     using XLStyleIndex = size_t; // custom data type for XLStyleIndex
+    using XLStyleSignatures = std::unordered_map<std::string, XLStyleIndex>; // style entry content -> index of first entry, see XLFonts::intern
 
     constexpr const uint32_t XLInvalidUInt16 = 0xffff;     // used to signal "value not defined" for uint16_t return types
     constexpr const uint32_t XLInvalidUInt32 = 0xffffffff; // used to signal "value not defined" for uint32_t return types
@@ -405,10 +407,20 @@ namespace OpenXLSX
          */
         XLStyleIndex create(XLNumberFormat copyFrom = XLNumberFormat{}, std::string styleEntriesPrefix = XLDefaultStyleEntriesPrefix);
 
+        /**
+         * @brief Look up an existing number format with the same content as the number format at index, so that identical number formats are stored only once.
+         *        If a duplicate exists and index is the last number format, e.g. because it was just created and modified, it is removed again.
+         *        The numFmtId is not part of the content: use numberFormatId() of the returned entry.
+         * @param index The index of the number format to deduplicate
+         * @returns The index of the first number format with identical content, or index if there is none
+         */
+        XLStyleIndex intern(XLStyleIndex index);
+
 
     private:                                         // ---------- Private Member Variables ---------- //
         std::unique_ptr<XMLNode> m_numberFormatsNode; /**< An XMLNode object with the number formats item */
         std::vector<XLNumberFormat> m_numberFormats;
+        XLStyleSignatures m_signatures;              /**< Content signatures of the entries, built on first use by intern */
     };
 
 
@@ -668,9 +680,18 @@ namespace OpenXLSX
          */
         XLStyleIndex create(XLFont copyFrom = XLFont{}, std::string styleEntriesPrefix = XLDefaultStyleEntriesPrefix);
 
+        /**
+         * @brief Look up an existing font with the same content as the font at index, so that identical fonts are stored only once.
+         *        If a duplicate exists and index is the last font, e.g. because it was just created and modified, it is removed again.
+         * @param index The index of the font to deduplicate
+         * @returns The index of the first font with identical content, or index if there is none
+         */
+        XLStyleIndex intern(XLStyleIndex index);
+
     private:                                         // ---------- Private Member Variables ---------- //
         std::unique_ptr<XMLNode> m_fontsNode;        /**< An XMLNode object with the fonts item */
         std::vector<XLFont> m_fonts;
+        XLStyleSignatures m_signatures;              /**< Content signatures of the entries, built on first use by intern */
     };
 
 
@@ -1141,9 +1162,18 @@ namespace OpenXLSX
          */
         XLStyleIndex create(XLFill copyFrom = XLFill{}, std::string styleEntriesPrefix = XLDefaultStyleEntriesPrefix);
 
+        /**
+         * @brief Look up an existing fill with the same content as the fill at index, so that identical fills are stored only once.
+         *        If a duplicate exists and index is the last fill, e.g. because it was just created and modified, it is removed again.
+         * @param index The index of the fill to deduplicate
+         * @returns The index of the first fill with identical content, or index if there is none
+         */
+        XLStyleIndex intern(XLStyleIndex index);
+
     private:                                         // ---------- Private Member Variables ---------- //
         std::unique_ptr<XMLNode> m_fillsNode;        /**< An XMLNode object with the fills item */
         std::vector<XLFill> m_fills;
+        XLStyleSignatures m_signatures;              /**< Content signatures of the entries, built on first use by intern */
     };
 
 
@@ -1446,9 +1476,18 @@ namespace OpenXLSX
          */
         XLStyleIndex create(XLBorder copyFrom = XLBorder{}, std::string styleEntriesPrefix = XLDefaultStyleEntriesPrefix);
 
+        /**
+         * @brief Look up an existing border with the same content as the border at index, so that identical borders are stored only once.
+         *        If a duplicate exists and index is the last border, e.g. because it was just created and modified, it is removed again.
+         * @param index The index of the border to deduplicate
+         * @returns The index of the first border with identical content, or index if there is none
+         */
+        XLStyleIndex intern(XLStyleIndex index);
+
     private:                                         // ---------- Private Member Variables ---------- //
         std::unique_ptr<XMLNode> m_bordersNode;      /**< An XMLNode object with the borders item */
         std::vector<XLBorder> m_borders;
+        XLStyleSignatures m_signatures;              /**< Content signatures of the entries, built on first use by intern */
     };
 
 
@@ -1870,10 +1909,19 @@ namespace OpenXLSX
          */
         XLStyleIndex create(XLCellFormat copyFrom = XLCellFormat{}, std::string styleEntriesPrefix = XLDefaultStyleEntriesPrefix);
 
+        /**
+         * @brief Look up an existing cell format with the same content as the cell format at index, so that identical cell formats are stored only once.
+         *        If a duplicate exists and index is the last cell format, e.g. because it was just created and modified, it is removed again.
+         * @param index The index of the cell format to deduplicate
+         * @returns The index of the first cell format with identical content, or index if there is none
+         */
+        XLStyleIndex intern(XLStyleIndex index);
+
     private:                                         // ---------- Private Member Variables ---------- //
         std::unique_ptr<XMLNode> m_cellFormatsNode;  /**< An XMLNode object with the cell formats item */
         std::vector<XLCellFormat> m_cellFormats;
         bool m_permitXfId{false};
+        XLStyleSignatures m_signatures;              /**< Content signatures of the entries, built on first use by intern */
     };
 
 
@@ -58,6 +58,8 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 
 // ===== OpenXLSX Includes ===== //
 #include "OpenXLSX-Exports.hpp"
+#include "XLStreamReader.hpp"
+#include "XLStreamWriter.hpp"
 #include "XLXmlFile.hpp"
 
 namespace OpenXLSX
@@ -163,6 +165,25 @@ namespace OpenXLSX
          */
         XLWorksheet worksheet(uint16_t index);
 
+        /**
+         * @brief Get a forward-only reader on the rows of the worksheet with the given name, which reads the worksheet
+         * XML without building an XML document for it.
+         * @param sheetName The name of the desired worksheet.
+         * @return An XLStreamReader positioned before the first row.
+         */
+        XLStreamReader streamWorksheet(const std::string& sheetName);
+
+        /**
+         * @brief Get a writer that replaces the rows of the worksheet with the given name by rows appended in ascending
+         * order, compressing them into the archive as they are written.
+         * @param sheetName The name of the desired worksheet.
+         * @param compressionLevel The deflate level of the worksheet entry, from 0 to 10; a negative level selects the
+         * default level.
+         * @return An XLStreamWriter positioned before the first row.
+         * @warning Existing XLWorksheet objects of the worksheet become invalid, see XLStreamWriter.
+         */
+        XLStreamWriter worksheetWriter(const std::string& sheetName, int compressionLevel = -1);
+
         /**
          * @brief Get the chartsheet with the given name.
          * @param sheetName The name of the desired chartsheet.
@@ -319,6 +340,20 @@ namespace OpenXLSX
         void print(std::basic_ostream<char>& ostr) const;
 
     private:    // ---------- Private Member Functions ---------- //
+        /**
+         * @brief Look up the node of a sheet in the sheets node of the workbook, through the index of the sheets by name
+         * @param sheetName The name of the sheet
+         * @return The sheet node, or an empty XMLNode if there is no sheet with that name
+         */
+        XMLNode sheetNodeByName(const std::string& sheetName) const;
+
+        /**
+         * @brief Look up the node of a sheet in the sheets node of the workbook, through the index of the sheets by r:id
+         * @param sheetRID The relationship ID of the sheet
+         * @return The sheet node, or an empty XMLNode if there is no sheet with that relationship ID
+         */
+        XMLNode sheetNodeByID(const std::string& sheetRID) const;
+
         /**
          * @brief
          * @return
@@ -332,6 +367,13 @@ namespace OpenXLSX
          */
         std::string sheetID(const std::string& sheetName);
 
+        /**
+         * @brief Get the path of the XML file of the sheet with the given name, relative to the archive root
+         * @param sheetName The name of the sheet
+         * @return The path, e.g. "xl/worksheets/sheet1.xml"
+         */
+        std::string sheetXmlPath(const std::string& sheetName);
+
         /**
          * @brief
          * @param sheetID
@@ -55,10 +55,13 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 // ===== External Includes ===== //
 #include <memory>
 #include <string>
+#include <vector>
 
 // ===== OpenXLSX Includes ===== //
 #include "OpenXLSX-Exports.hpp"
 #include "XLContentTypes.hpp"
+#include "XLNodeIndex.hpp"
+#include "XLRowIndex.hpp"
 #include "XLXmlParser.hpp"
 
 namespace OpenXLSX
@@ -226,6 +229,43 @@ namespace OpenXLSX
          */
         const XMLDocument* getXmlDocument() const;
 
+        /**
+         * @brief Access the row index of the underlying XMLDocument, which is only meaningful for worksheets.
+         * @return A pointer to the XLRowIndex object, created on first access.
+         */
+        XLRowIndex* getRowIndex() const;
+
+        /**
+         * @brief Access the index of the element children of a node in the underlying XMLDocument by one of their
+         * attributes, e.g. of the sheet nodes in a workbook by "name". There is one index per attribute name.
+         * @param attributeName The name of the attribute that the children are indexed by.
+         * @return A pointer to the XLNodeIndex object, created on first access.
+         */
+        XLNodeIndex* getNodeIndex(const std::string& attributeName) const;
+
+        /**
+         * @brief Parse the XML document from the .xlsx zip archive, if that has not happened yet. Unlike getXmlDocument,
+         * this does not make the document dirty. It may be called concurrently for different XLXmlData objects of the
+         * same XLDocument once their archive entries have been prefetched with IZipArchive::prefetchEntries.
+         */
+        void loadXmlDocument() const;
+
+        /**
+         * @brief Test whether the XML document may differ from the copy in the .xlsx zip archive. A part becomes dirty
+         * once it is accessed through getXmlDocument or its raw data is set, because the XMLNode handles handed out
+         * from then on can modify it without passing through this object. Parts that are not dirty can be copied
+         * through verbatim when saving.
+         * @return true if the XML document must be serialized when saving, otherwise false
+         */
+        bool isDirty() const;
+
+        /**
+         * @brief Release the parsed XML document after its archive entry was replaced by other means, e.g. by an
+         * XLStreamWriter. The document is parsed again from the archive on next access, and is no longer dirty.
+         * @warning All XMLNode handles into the document, and the objects holding them, become invalid.
+         */
+        void discardXmlDocument();
+
         /**
          * @brief Test whether there is an XML file linked to this object
          * @return true if there is no underlying XML file, otherwise false
@@ -240,6 +280,9 @@ namespace OpenXLSX
         std::string                          m_xmlID {};     /**< The relationship ID of the XML data. >*/
         XLContentType                        m_xmlType {};   /**< The type represented by the XML data. >*/
         mutable std::unique_ptr<XMLDocument> m_xmlDoc;       /**< The underlying XMLDocument object. >*/
+        mutable std::unique_ptr<XLRowIndex>  m_rowIndex;     /**< Row number index into sheetData, for worksheets. >*/
+        mutable std::vector<std::unique_ptr<XLNodeIndex>> m_nodeIndices; /**< Attribute indices, see getNodeIndex. >*/
+        mutable bool                         m_dirty {};     /**< Whether the XML document has been accessed or set. >*/
     };
 }    // namespace OpenXLSX
 
@@ -60,7 +60,7 @@ namespace OpenXLSX
 {
 #   define ENABLE_XML_NAMESPACES 1    // disable this line to control behavior via compiler flag
 #   define NO_MULTITHREADING_SAFETY 1 // if this is defined, the function namespaced_name_char will be used for XML namespace support,
-//                                    //  using a static character array for improved performance when multithreading conflicts are not a risk
+//                                    //  using a thread_local character array for improved performance over namespaced_name_shared_ptr
 
 #   ifdef ENABLE_XML_NAMESPACES
         // ===== Macro for NAMESPACED_NAME when node names might need to be prefixed with the current node's namespace
@@ -53,6 +53,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #endif // _MSC_VER
 
 // ===== OpenXLSX Includes ===== //
+#include "IZipArchive.hpp"
 #include "OpenXLSX-Exports.hpp"
 
 namespace Zippy
@@ -130,10 +131,11 @@ namespace OpenXLSX
         void close();
 
         /**
-         * @brief
-         * @param path
+         * @brief Save the archive, compressing the modified entries on options.threadCount threads.
+         * @param path The path to save to; the path the archive was opened from if empty.
+         * @param options The compression level and thread count to use.
          */
-        void save(const std::string& path = "");
+        void save(const std::string& path = "", const XLZipSaveOptions& options = XLZipSaveOptions{});
 
         /**
          * @brief
@@ -162,6 +164,40 @@ namespace OpenXLSX
          */
         bool hasEntry(const std::string& entryName) const;
 
+        /**
+         * @brief Decompress an entry into a buffer allocated with the given function, without keeping a copy in the archive.
+         * @param name The name of the entry.
+         * @param size Receives the size of the entry data.
+         * @param allocate The allocation function; the caller owns the returned buffer.
+         * @param deallocate The matching deallocation function, used if the extraction fails.
+         * @return A pointer to the buffer holding the entry data.
+         */
+        void* getEntryBuffer(const std::string& name, size_t& size, void* (*allocate)(size_t), void (*deallocate)(void*)) const;
+
+        /**
+         * @brief Open a forward-only stream over the data of an entry, which is decompressed as it is read.
+         * @param name The name of the entry.
+         * @return The stream; it must not be used after the archive was closed or modified.
+         */
+        XLZipEntryStream openEntryStream(const std::string& name) const;
+
+        /**
+         * @brief Open a writer for the data of a new or replaced entry, which is compressed as it is written. The entry
+         * is added when the writer is called with a size of 0, and is not compressed again when the archive is saved.
+         * @param name The name of the entry.
+         * @param compressionLevel The deflate level from 0 to 10; a negative level selects the default level.
+         * @return The writer; it must not be used after the archive was closed.
+         */
+        XLZipEntrySink openEntrySink(const std::string& name, int compressionLevel);
+
+        /**
+         * @brief Decompress the given entries into memory on up to threadCount threads, so that getEntry can
+         * subsequently be called for them concurrently.
+         * @param names The names of the entries to decompress.
+         * @param threadCount The maximum number of threads to use; 0 uses all hardware threads.
+         */
+        void prefetchEntries(const std::vector<std::string>& names, unsigned threadCount);
+
     private:
         std::shared_ptr<Zippy::ZipArchive> m_archive; /**< */
     };
@@ -59,8 +59,10 @@ namespace OpenXLSX { // utility functions findRowNode and findCellNode
     /**
      * @details
      */
-    XMLNode findRowNode(XMLNode sheetDataNode, uint32_t rowNumber)
+    XMLNode findRowNode(XMLNode sheetDataNode, uint32_t rowNumber, XLRowIndex* rowIndex)
     {
+        if (rowIndex != nullptr) return rowIndex->findRowNode(sheetDataNode, rowNumber);
+
         if (rowNumber < 1 || rowNumber > OpenXLSX::MAX_ROWS) {
             using namespace std::literals::string_literals;
             throw XLCellAddressError("rowNumber "s + std::to_string( rowNumber ) + " is outside valid range [1;"s + std::to_string(OpenXLSX::MAX_ROWS) + "]"s);
@@ -105,17 +107,24 @@ namespace OpenXLSX { // utility functions findRowNode and findCellNode
         if (rowNode.empty()) return XMLNode{};
 
         XMLNode cellNode = rowNode.last_child_of_type(pugi::node_element);
+        auto    columnOf = [](XMLNode node) { return XLCellReference::columnFromAddress(node.attribute("r").value()); };
 
         // ===== If there are no cells in the current row, or the requested cell is beyond the last cell in the row...
-        if (cellNode.empty() || (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber))
-            return XMLNode{};
+        const uint16_t lastColumn = (cellNode.empty() ? 0 : columnOf(cellNode));
+        if (cellNode.empty() || lastColumn < columnNumber)
+            return XMLNode{}; // fail
 
         // ===== If the requested node is closest to the end, start from the end and search backwards...
-        if (XLCellReference(cellNode.attribute("r").value()).column() - columnNumber < columnNumber) {
-            while (not cellNode.empty() && (XLCellReference(cellNode.attribute("r").value()).column() > columnNumber))
+        if (lastColumn - columnNumber < columnNumber) {
+            uint16_t column = lastColumn;
+            while (column > columnNumber) {
                 cellNode = cellNode.previous_sibling_of_type(pugi::node_element);
-            if (cellNode.empty() || (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber))
-                return XMLNode{};
+                if (cellNode.empty()) return XMLNode{}; // fail
+                column = columnOf(cellNode);
+            }
+            // ===== If the backwards search failed to locate the requested cell
+            if (column < columnNumber)
+                return XMLNode{}; // fail
         }
         // ===== Otherwise, start from the beginning
         else {
@@ -123,10 +132,14 @@ namespace OpenXLSX { // utility functions findRowNode and findCellNode
             cellNode = rowNode.first_child_of_type(pugi::node_element);
 
             // ===== It has been verified above that the requested columnNumber is <= the column number of the last node_element, therefore this loop will halt:
-            while (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber)
+            uint16_t column = columnOf(cellNode);
+            while (column < columnNumber) {
                 cellNode = cellNode.next_sibling_of_type(pugi::node_element);
-            if (XLCellReference(cellNode.attribute("r").value()).column() > columnNumber)
-                return XMLNode{};
+                column   = columnOf(cellNode);
+            }
+            // ===== If the forwards search failed to locate the requested cell
+            if (column > columnNumber)
+                return XMLNode{}; // fail
         }
         return cellNode;
     }
@@ -144,6 +157,11 @@ XLCellIterator::XLCellIterator(const XLCellRange& cellRange, XLIteratorLocation
       m_endReached(false),
       m_hintNode(),
       m_hintRow(0),
+      m_cachedRow(0),
+      m_cachedRowNode(),
+      m_rowCells(),
+      m_rowTail(),
+      m_rowCursor(0),
       m_currentCell(),
       m_currentCellStatus(XLNotLoaded),
       m_currentRow(0),
@@ -178,6 +196,11 @@ XLCellIterator::XLCellIterator(const XLCellIterator& other)
       m_endReached   (other.m_endReached),
       m_hintNode     (other.m_hintNode),
       m_hintRow      (other.m_hintRow),
+      m_cachedRow    (other.m_cachedRow),
+      m_cachedRowNode(other.m_cachedRowNode),
+      m_rowCells     (other.m_rowCells),
+      m_rowTail      (other.m_rowTail),
+      m_rowCursor    (other.m_rowCursor),
       m_currentCell  (other.m_currentCell),
       m_currentCellStatus(other.m_currentCellStatus),
       m_currentRow   (other.m_currentRow),
@@ -202,7 +225,12 @@ XLCellIterator& XLCellIterator::operator=(const XLCellIterator& other)
         m_sharedStrings =  other.m_sharedStrings;
         m_endReached    =  other.m_endReached;
         m_hintNode      =  other.m_hintNode;
-        m_hintRow       =  other.m_currentRow;
+        m_hintRow       =  other.m_hintRow;
+        m_cachedRow     =  other.m_cachedRow;
+        m_cachedRowNode =  other.m_cachedRowNode;
+        m_rowCells      =  other.m_rowCells;
+        m_rowTail       =  other.m_rowTail;
+        m_rowCursor     =  other.m_rowCursor;
         m_currentCell   =  other.m_currentCell;
         m_currentCellStatus = other.m_currentCellStatus;
         m_currentRow    =  other.m_currentRow;
@@ -236,6 +264,58 @@ XLCellIterator& XLCellIterator::operator=(XLCellIterator&& other) noexcept = def
 //     return *this;
 // }
 
+/**
+ * @details The rows of the range are visited in ascending order, so the row node for m_currentRow is searched forwards from
+ *  the last existing row found so far (m_hintNode). Once found, the cells of the row that fall within the range are decoded
+ *  into m_rowCells, so that each cell reference is parsed only once per row instead of once for every cell visited.
+ * @note Like m_hintNode, the cached nodes remain valid only as long as the rows and cells of the range are not deleted by
+ *  other means while the iterator is in use.
+ */
+void XLCellIterator::loadRow(bool createIfMissing)
+{
+    XMLNode rowNode = (m_hintNode.empty() ? m_dataNode->first_child_of_type(pugi::node_element) : m_hintNode);
+    if (not m_hintNode.empty() && m_hintRow > m_currentRow)
+        throw XLInternalError("XLCellIterator::loadRow: an internal error occured (m_currentRow < m_hintRow)");
+
+    // ===== Search forwards for the row, moving the hint along with every row passed
+    while (not rowNode.empty()) {
+        uint32_t rowNo = static_cast<uint32_t>(rowNode.attribute("r").as_ullong());
+        if (rowNo > m_currentRow) break; // if desired row was passed, rowNode is the row before which a missing row belongs
+        m_hintNode = rowNode;
+        m_hintRow  = rowNo;
+        if (rowNo == m_currentRow) break;
+        rowNode = rowNode.next_sibling_of_type(pugi::node_element);
+    }
+
+    if (m_hintNode.empty() || m_hintRow != m_currentRow) { // row does not exist
+        if (createIfMissing) {
+            rowNode = (rowNode.empty() ? m_dataNode->append_child("row") : m_dataNode->insert_child_before("row", rowNode));
+            rowNode.append_attribute("r").set_value(m_currentRow);
+            m_hintNode = rowNode;
+            m_hintRow  = m_currentRow;
+        }
+        else
+            rowNode = XMLNode{};
+    }
+
+    // ===== Cache the column numbers of all cells within the range
+    m_cachedRow     = m_currentRow;
+    m_cachedRowNode = rowNode;
+    m_rowCells.clear();
+    m_rowTail   = XMLNode{};
+    m_rowCursor = 0;
+    XMLNode cellNode = rowNode.first_child_of_type(pugi::node_element);
+    while (not cellNode.empty()) {
+        uint16_t colNo = XLCellReference::columnFromAddress(cellNode.attribute("r").value());
+        if (colNo > m_bottomRight.column()) {
+            m_rowTail = cellNode;
+            break;
+        }
+        if (colNo >= m_topLeft.column()) m_rowCells.emplace_back(colNo, cellNode);
+        cellNode = cellNode.next_sibling_of_type(pugi::node_element);
+    }
+}
+
 /**
  * @brief update m_currentCell by fetching (or inserting) a cell at m_currentRow, m_currentColumn
  */
@@ -250,72 +330,50 @@ void XLCellIterator::updateCurrentCell(bool createIfMissing)
     if (m_endReached)
         throw XLInputError("XLCellIterator updateCurrentCell: iterator should not be dereferenced when endReached() == true");
 
-    // ===== Cell needs to be updated
+    // ===== Cell needs to be updated: make sure the cells of m_currentRow are cached
+    if (m_currentRow != m_cachedRow || (createIfMissing && m_cachedRowNode.empty()))
+        loadRow(createIfMissing);
 
-    if (m_hintNode.empty()) { // no hint has been established: fetch first cell node the "tedious" way
-        if (createIfMissing)      // getCellNode / getRowNode create missing cells
-            m_currentCell = XLCell(getCellNode(getRowNode(*m_dataNode, m_currentRow), m_currentColumn, 0, *m_colStyles), m_sharedStrings.get());
-        else                      // findCellNode / findRowNode return an empty cell for missing cells
-            m_currentCell = XLCell(findCellNode(findRowNode(*m_dataNode, m_currentRow), m_currentColumn), m_sharedStrings.get());
+    if (m_cachedRowNode.empty()) { // row does not exist and was not created
+        m_currentCell       = XLCell{};
+        m_currentCellStatus = XLNoSuchCell;
+        return;
     }
-    else {
-        // ===== Find or create, and fetch an XLCell at m_currentRow, m_currentColumn
-        if (m_currentRow == m_hintRow) { // new cell is within the same row
-            // ===== Start from m_hintNode and search forwards...
-            XMLNode cellNode = m_hintNode.next_sibling_of_type(pugi::node_element);
-            uint16_t colNo = 0;
-            while (not cellNode.empty()) {
-                colNo = XLCellReference(cellNode.attribute("r").value()).column();
-                if(colNo >= m_currentColumn) break; // if desired cell was reached / passed, break before incrementing cellNode
-                cellNode = cellNode.next_sibling_of_type(pugi::node_element);
-            }
-            if (colNo != m_currentColumn) cellNode = XMLNode{}; // if a higher column number was found, set empty node (means: "missing")
-            // ===== Create missing cell node if createIfMissing == true
-            if (createIfMissing && cellNode.empty()) {
-                cellNode = m_hintNode.parent().insert_child_after("c", m_hintNode);
-                setDefaultCellAttributes(cellNode, XLCellReference(m_currentRow, m_currentColumn).address(), m_hintNode.parent(),
-                /**/                      m_currentColumn, *m_colStyles);
-            }
-            m_currentCell = XLCell(cellNode, m_sharedStrings.get()); // cellNode.empty() can be true if createIfMissing == false and cell is not found
+
+    // ===== Move the cursor to the first cached cell at or after m_currentColumn - the columns are visited in ascending order,
+    //        so the cursor only needs to be rewound if the iterator was copied from an iterator at a later position
+    if (m_rowCursor > 0 && (m_rowCursor > m_rowCells.size() || m_rowCells[m_rowCursor - 1].first >= m_currentColumn))
+        m_rowCursor = 0;
+    while (m_rowCursor < m_rowCells.size() && m_rowCells[m_rowCursor].first < m_currentColumn) ++m_rowCursor;
+
+    XMLNode cellNode{};
+    if (m_rowCursor < m_rowCells.size() && m_rowCells[m_rowCursor].first == m_currentColumn)
+        cellNode = m_rowCells[m_rowCursor].second;
+    else if (createIfMissing) {
+        // ===== The missing cell belongs before the next cached cell, or before the first cell beyond the range. Check the nodes
+        //        before that position, in case cells were inserted into the row by other means since it was cached
+        XMLNode  nextNode = (m_rowCursor < m_rowCells.size() ? m_rowCells[m_rowCursor].second : m_rowTail);
+        XMLNode  prevNode = (nextNode.empty() ? m_cachedRowNode.last_child_of_type(pugi::node_element)
+        /**/                                  : nextNode.previous_sibling_of_type(pugi::node_element));
+        uint16_t prevColumn = 0;
+        while (not prevNode.empty()) {
+            prevColumn = XLCellReference::columnFromAddress(prevNode.attribute("r").value());
+            if (prevColumn <= m_currentColumn) break;
+            nextNode = prevNode;
+            prevNode = prevNode.previous_sibling_of_type(pugi::node_element);
         }
-        else if (m_currentRow > m_hintRow) {
-            // ===== Start from m_hintNode parent row and search forwards...
-            XMLNode rowNode = m_hintNode.parent().next_sibling_of_type(pugi::node_element);
-            uint32_t rowNo = 0;
-            while (not rowNode.empty()) {
-                rowNo = rowNode.attribute("r").as_ullong();
-                if (rowNo >= m_currentRow) break; // if desired row was reached / passed, break before incrementing rowNode
-                rowNode = rowNode.next_sibling_of_type(pugi::node_element);
-            }
-            if (rowNo != m_currentRow) rowNode = XMLNode{}; // if a higher row number was found, set empty node (means: "missing")
-            // ===== Create missing row node if createIfMissing == true
-            if (createIfMissing && rowNode.empty()) {
-                rowNode = m_dataNode->insert_child_after("row", m_hintNode.parent());
-                rowNode.append_attribute("r").set_value(m_currentRow);
-            }
-            if (rowNode.empty())    // if row could not be found / created
-                m_currentCell = XLCell{}; // make sure m_currentCell is set to an empty cell
-            else {                  // else: row found
-                if (createIfMissing) {
-                    // ===== Pass the already known m_currentRow to getCellNode so that it does not have to be fetched again
-                    m_currentCell = XLCell(getCellNode (rowNode, m_currentColumn, m_currentRow, *m_colStyles), m_sharedStrings.get());
-                }
-                else // ===== Do a "soft find" if a missing cell shall not be created
-                    m_currentCell = XLCell(findCellNode(rowNode, m_currentColumn), m_sharedStrings.get());
-            }
+        if (not prevNode.empty() && prevColumn == m_currentColumn)
+            cellNode = prevNode;
+        else {
+            cellNode = (nextNode.empty() ? m_cachedRowNode.append_child("c") : m_cachedRowNode.insert_child_before("c", nextNode));
+            setDefaultCellAttributes(cellNode, XLCellReference(m_currentRow, m_currentColumn).address(), m_cachedRowNode,
+            /**/                      m_currentColumn, *m_colStyles);
         }
-        else
-            throw XLInternalError("XLCellIterator::updateCurrentCell: an internal error occured (m_currentRow < m_hintRow)");
+        m_rowCells.insert(m_rowCells.begin() + static_cast<std::ptrdiff_t>(m_rowCursor), std::make_pair(m_currentColumn, cellNode));
     }
 
-    if (m_currentCell.empty())    // if cell is confirmed missing
-        m_currentCellStatus = XLNoSuchCell; // mark this status for further calls to updateCurrentCell()
-    else {
-        // ===== If the current cell exists, update the hints
-        m_hintNode   = *m_currentCell.m_cellNode;    // 2024-08-11: don't store a full XLCell, just the XMLNode, for better performance
-        m_hintRow    = m_currentRow;
-        m_currentCellStatus = XLLoaded; // mark cell status for further calls to updateCurrentCell()
-    }
+    m_currentCell = XLCell(cellNode, m_sharedStrings.get()); // cellNode.empty() can be true if createIfMissing == false and cell is not found
+    m_currentCellStatus = (m_currentCell.empty() ? XLNoSuchCell : XLLoaded); // mark cell status for further calls to updateCurrentCell()
 }
 
 /**
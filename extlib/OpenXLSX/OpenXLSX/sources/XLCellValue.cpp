@@ -11,6 +11,7 @@
 #include "XLCell.hpp"
 #include "XLCellValue.hpp"
 #include "XLException.hpp"
+#include "XLNumberCodec.hpp"
 
 using namespace OpenXLSX;
 
@@ -253,8 +254,7 @@ XLValueType XLCellValueProxy::type() const
 
     // ===== If a Type attribute is not present, but a value node is, the cell contains a number.
     if (m_cellNode->attribute("t").empty() || ((strcmp(m_cellNode->attribute("t").value(), "n") == 0) && not m_cellNode->child("v").empty())) {
-        if (const std::string numberString = m_cellNode->child("v").text().get();
-            numberString.find('.') != std::string::npos || numberString.find("E-") != std::string::npos || numberString.find("e-") != std::string::npos)
+        if (const char* numberText = m_cellNode->child("v").text().get(); isFloatText(numberText, numberText + std::strlen(numberText)))
             return XLValueType::Float;
         return XLValueType::Integer;
     }
@@ -321,7 +321,8 @@ void XLCellValueProxy::setInteger(int64_t numberValue) // NOLINT
     m_cellNode->remove_attribute("t");
 
     // ===== Set the text of the value node.
-    m_cellNode->child("v").text().set(numberValue);
+    char number[XLNumberBufferSize];
+    m_cellNode->child("v").text().set(number, static_cast<size_t>(formatInteger(numberValue, number) - number));
 
     // ===== Disable space preservation (only relevant for strings).
     m_cellNode->child("v").remove_attribute(m_cellNode->child("v").attribute("xml:space"));
@@ -381,8 +382,9 @@ void XLCellValueProxy::setFloat(double numberValue)
         // ===== The type ("t") attribute is not required for number values.
         m_cellNode->remove_attribute("t");
 
-        // ===== Set the text of the value node.
-        m_cellNode->child("v").text().set(numberValue);
+        // ===== Set the text of the value node, using the shortest text that reads back as the same value.
+        char number[XLNumberBufferSize];
+        m_cellNode->child("v").text().set(number, static_cast<size_t>(formatFloat(numberValue, number) - number));
 
         // ===== Disable space preservation (only relevant for strings).
         m_cellNode->child("v").remove_attribute(m_cellNode->child("v").attribute("xml:space"));
@@ -417,10 +419,10 @@ void XLCellValueProxy::setString(const char* stringValue) // NOLINT
     // ===== Set the type attribute.
     m_cellNode->attribute("t").set_value("s");
 
-    // ===== Get or create the index in the XLSharedStrings object.
-    const auto index = (m_cell->m_sharedStrings.get().stringExists(stringValue)
-    /**/                                                    ?          m_cell->m_sharedStrings.get().getStringIndex(stringValue)
-    /**/                                                             : m_cell->m_sharedStrings.get().appendString(stringValue));
+    // ===== Get or create the index in the XLSharedStrings object (single hash lookup).
+    const XLSharedStrings& sharedStrings = m_cell->m_sharedStrings.get();
+    int32_t index = sharedStrings.getStringIndex(stringValue);
+    if (index < 0) index = sharedStrings.appendString(stringValue);
 
     // ===== Set the text of the value node.
     m_cellNode->child("v").text().set(index);
@@ -460,10 +462,10 @@ XLCellValue XLCellValueProxy::getValue() const
             return XLCellValue().clear();
 
         case XLValueType::Float:
-            return XLCellValue { m_cellNode->child("v").text().as_double() };
+            return XLCellValue { textToFloat(m_cellNode->child("v").text().get()) };
 
         case XLValueType::Integer:
-            return XLCellValue { m_cellNode->child("v").text().as_llong() };
+            return XLCellValue { textToInteger(m_cellNode->child("v").text().get()) };
 
         case XLValueType::String:
             if (strcmp(m_cellNode->attribute("t").value(), "s") == 0)
@@ -0,0 +1,265 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+// ===== External Includes ===== //
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+// ===== OpenXLSX Includes ===== //
+#include "XLCellReference.hpp"
+#include "XLColumnarRange.hpp"
+#include "XLException.hpp"
+#include "XLNumberCodec.hpp"
+
+using namespace OpenXLSX;
+
+namespace
+{
+    /**
+     * @brief Set the validity bit of a row
+     */
+    void setValid(XLColumnarColumn& column, uint32_t row) { column.validity[row / 64] |= uint64_t { 1 } << (row % 64); }
+
+    /**
+     * @brief Store a string that is held in the arena at offset in a String column
+     */
+    void storeString(XLColumnarColumn& column, uint32_t row, uint64_t offset, uint32_t length, int32_t sharedStringIndex)
+    {
+        column.stringOffsets[row]       = offset;
+        column.stringLengths[row]       = length;
+        column.sharedStringIndices[row] = sharedStringIndex;
+        setValid(column, row);
+    }
+
+    /**
+     * @brief Format a value of a Boolean, Integer or Float column as text - booleans are formatted as 1 and 0, as they
+     * may have been widened to integers before
+     * @return the number of characters written to buffer
+     */
+    size_t formatValue(XLColumnType type, int64_t integer, double number, char (&buffer)[XLNumberBufferSize])
+    {
+        return static_cast<size_t>((type == XLColumnType::Float ? formatFloat(number, buffer) : formatInteger(integer, buffer)) - buffer);
+    }
+}    // namespace
+
+/**
+ * @details Cells are visited in XML order, and each value is stored in the buffer of its column's current type, after
+ * widening the column if the value is of a wider type. As a column can be widened at most three times, converting the
+ * values stored so far does not affect the single pass over the XML. Shared strings are copied to the arena on first
+ * use only.
+ */
+XLColumnarRange::XLColumnarRange(XMLNode                sheetDataNode,
+                                 XLRowIndex*            rowIndex,
+                                 const XLSharedStrings& sharedStrings,
+                                 uint32_t               firstRow,
+                                 uint16_t               firstColumn,
+                                 uint32_t               lastRow,
+                                 uint16_t               lastColumn)
+    : m_firstRow(firstRow),
+      m_firstColumn(firstColumn),
+      m_rowCount(lastRow - firstRow + 1),
+      m_columns(static_cast<size_t>(lastColumn - firstColumn + 1))
+{
+    for (auto& column : m_columns) column.validity.assign((m_rowCount + 63) / 64, 0);
+
+    std::unordered_map<int32_t, std::pair<uint64_t, uint32_t>> sharedStringSpans;    // shared string index -> arena offset & length
+    char buffer[XLNumberBufferSize];
+
+    auto storeNumber = [&](XLColumnarColumn& column, uint32_t row, XLColumnType type, int64_t integer, double number) {
+        if (column.type < type) widen(column, type);
+        switch (column.type) {
+            case XLColumnType::Boolean:
+            case XLColumnType::Integer:
+                column.integers[row] = integer;
+                setValid(column, row);
+                break;
+            case XLColumnType::Float:
+                column.floats[row] = (type == XLColumnType::Float ? number : static_cast<double>(integer));
+                setValid(column, row);
+                break;
+            default: {    // String
+                size_t length = formatValue(type, integer, number, buffer);
+                storeString(column, row, m_stringArena.size(), static_cast<uint32_t>(length), -1);
+                m_stringArena.append(buffer, length);
+                break;
+            }
+        }
+    };
+
+    auto storeText = [&](XLColumnarColumn& column, uint32_t row, const char* text, int32_t sharedStringIndex) {
+        if (column.type < XLColumnType::String) widen(column, XLColumnType::String);
+        if (sharedStringIndex >= 0) {
+            auto span = sharedStringSpans.find(sharedStringIndex);
+            if (span == sharedStringSpans.end()) {
+                uint32_t length = static_cast<uint32_t>(std::strlen(text));
+                span = sharedStringSpans.emplace(sharedStringIndex, std::make_pair(m_stringArena.size(), length)).first;
+                m_stringArena.append(text, length);
+            }
+            storeString(column, row, span->second.first, span->second.second, sharedStringIndex);
+            return;
+        }
+        uint32_t length = static_cast<uint32_t>(std::strlen(text));
+        storeString(column, row, m_stringArena.size(), length, -1);
+        m_stringArena.append(text, length);
+    };
+
+    // ===== Locate the first row node of the range, then walk the row nodes up to the last row of the range
+    XMLNode rowNode {};
+    if (rowIndex != nullptr)
+        rowNode = rowIndex->findRowNodeAtOrAfter(sheetDataNode, firstRow);
+    else {
+        rowNode = sheetDataNode.first_child_of_type(pugi::node_element);
+        while (not rowNode.empty() && rowNode.attribute("r").as_ullong() < firstRow) rowNode = rowNode.next_sibling_of_type(pugi::node_element);
+    }
+
+    for (; not rowNode.empty(); rowNode = rowNode.next_sibling_of_type(pugi::node_element)) {
+        uint32_t rowNumber = static_cast<uint32_t>(rowNode.attribute("r").as_ullong());
+        if (rowNumber > lastRow) break;
+        if (rowNumber < firstRow) continue;    // only possible for a row node without row number
+        uint32_t row = rowNumber - firstRow;
+
+        uint16_t columnNumber = 0;
+        for (XMLNode cellNode = rowNode.first_child_of_type(pugi::node_element); not cellNode.empty();
+             cellNode         = cellNode.next_sibling_of_type(pugi::node_element)) {
+            XMLAttribute reference = cellNode.attribute("r");
+            columnNumber           = (reference.empty() ? static_cast<uint16_t>(columnNumber + 1) : XLCellReference::columnFromAddress(reference.value()));
+            if (columnNumber < firstColumn) continue;
+            if (columnNumber > lastColumn) break;
+            XLColumnarColumn& column = m_columns[columnNumber - firstColumn];
+
+            // ===== Determine the cell value the same way as XLCellValueProxy, without constructing it
+            const char* type  = cellNode.attribute("t").value();
+            XMLNode     value = cellNode.child("v");
+            if (*type == '\0' || std::strcmp(type, "n") == 0) {
+                if (value.empty()) continue;
+                const char* text = value.text().get();
+                const char* end  = text + std::strlen(text);
+                if (!isFloatText(text, end))
+                    storeNumber(column, row, XLColumnType::Integer, textToInteger(text), 0.0);
+                else
+                    storeNumber(column, row, XLColumnType::Float, 0, textToFloat(text));
+            }
+            else if (std::strcmp(type, "s") == 0) {
+                int32_t index = value.text().as_int(-1);
+                if (index >= 0 && index < sharedStrings.stringCount()) storeText(column, row, sharedStrings.getString(index), index);
+            }
+            else if (std::strcmp(type, "b") == 0)
+                storeNumber(column, row, XLColumnType::Boolean, value.text().as_bool() ? 1 : 0, 0.0);
+            else if (std::strcmp(type, "str") == 0)
+                storeText(column, row, value.text().get(), -1);
+            else if (std::strcmp(type, "inlineStr") == 0)
+                storeText(column, row, cellNode.child("is").child("t").text().get(), -1);
+            // else: error values ("e") and unknown types have no value
+        }
+    }
+}
+
+/**
+ * @details
+ */
+const XLColumnarColumn& XLColumnarRange::column(uint16_t index) const
+{
+    if (index >= m_columns.size()) {
+        using namespace std::literals::string_literals;
+        throw XLInputError("XLColumnarRange::column: index "s + std::to_string(index) + " is out of range"s);
+    }
+    return m_columns[index];
+}
+
+/**
+ * @details
+ */
+std::string_view XLColumnarRange::stringValue(uint16_t column, uint32_t row) const
+{
+    const XLColumnarColumn& col = this->column(column);
+    if (col.type != XLColumnType::String || row >= m_rowCount) return {};
+    return std::string_view(m_stringArena).substr(col.stringOffsets[row], col.stringLengths[row]);
+}
+
+/**
+ * @details The values stored so far are converted to the new type, and the buffers of the previous type are released.
+ */
+void XLColumnarRange::widen(XLColumnarColumn& column, XLColumnType type)
+{
+    XLColumnType previous = column.type;
+    column.type           = type;
+
+    switch (type) {
+        case XLColumnType::Boolean:
+        case XLColumnType::Integer:
+            if (previous == XLColumnType::Empty) column.integers.assign(m_rowCount, 0);
+            break;
+
+        case XLColumnType::Float:
+            column.floats.assign(m_rowCount, 0.0);
+            for (uint32_t row = 0; row < m_rowCount && not column.integers.empty(); ++row)
+                column.floats[row] = static_cast<double>(column.integers[row]);
+            column.integers = std::vector<int64_t> {};
+            break;
+
+        case XLColumnType::String: {
+            column.stringOffsets.assign(m_rowCount, 0);
+            column.stringLengths.assign(m_rowCount, 0);
+            column.sharedStringIndices.assign(m_rowCount, -1);
+            if (previous != XLColumnType::Empty) {
+                char buffer[XLNumberBufferSize];
+                for (uint32_t row = 0; row < m_rowCount; ++row) {
+                    if (not column.isValid(row)) continue;
+                    size_t length = (previous == XLColumnType::Float ? formatValue(previous, 0, column.floats[row], buffer)
+                                                                     : formatValue(previous, column.integers[row], 0.0, buffer));
+                    storeString(column, row, m_stringArena.size(), static_cast<uint32_t>(length), -1);
+                    m_stringArena.append(buffer, length);
+                }
+            }
+            column.integers = std::vector<int64_t> {};
+            column.floats   = std::vector<double> {};
+            break;
+        }
+
+        default:
+            break;
+    }
+}
@@ -44,8 +44,9 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
  */
 
 // ===== External Includes ===== //
-// #include <algorithm>
+#include <algorithm>      // std::stable_sort
 #include <pugixml.hpp>
+#include <string_view>    // std::string_view
 
 // ===== OpenXLSX Includes ===== //
 #include "XLDocument.hpp"               // pugi_parse_settings
@@ -85,6 +86,116 @@ namespace {
         }
         return result;
     }
+
+    /**
+     * @details pack a cell position into a key for the comment and shape indices - keys sort like the cells of a worksheet
+     */
+    uint64_t cellKey(uint32_t row, uint16_t column) { return (static_cast<uint64_t>(row) << 16) | column; }
+
+    /**
+     * @details replace the content of a comment node with commentText and set its ref and authorId attributes
+     */
+    void setCommentContent(XMLNode comment, std::string const& address, std::string const& commentText, uint16_t authorId)
+    {
+        comment.remove_children();                                             // clear node content
+        if (comment.attribute("ref").empty())                                  // if ref has to be created
+            comment.append_attribute("ref").set_value(address.c_str());        // then do so - otherwise it can remain untouched
+        appendAndSetAttribute(comment, "authorId", std::to_string(authorId));  // update authorId
+        XMLNode tNode = comment.prepend_child("text").prepend_child("t");      // insert <text><t/></text> nodes
+        tNode.append_attribute("xml:space").set_value("preserve");             // set <t> node attribute xml:space
+        tNode.prepend_child(pugi::node_pcdata).set_value(commentText.c_str()); // finally, insert <t> node_pcdata value
+    }
+
+    /**
+     * @details format a (new or existing) comment shape and anchor it next to the cell at destRow, destCol
+     */
+    void formatCommentShape(XLShape& cShape, uint32_t destRow, uint16_t destCol)
+    {
+        using namespace std::literals::string_literals;
+        cShape.setFillColor("#ffffc0");
+        cShape.setStroked(true);
+        // setType: already done by XLVmlDrawing::createShape
+        cShape.setAllowInCell(false);
+        {
+            // XLShapeStyle shapeStyle("position:absolute;margin-left:100pt;margin-top:0pt;width:50pt;height:50.0pt;mso-wrap-style:none;v-text-anchor:middle;visibility:hidden");
+            XLShapeStyle shapeStyle{}; // default construct with meaningful values
+            cShape.setStyle(shapeStyle);
+        }
+
+        XLShapeClientData clientData = cShape.clientData();
+        clientData.setObjectType("Note");
+        clientData.setMoveWithCells();
+        clientData.setSizeWithCells();
+
+        {
+            constexpr const uint16_t leftColOffset = 1;
+            constexpr const uint16_t widthCols = 2;
+            constexpr const uint16_t topRowOffset = 1;
+            constexpr const uint16_t heightRows = 2;
+
+            uint16_t anchorLeftCol, anchorRightCol;
+            if( OpenXLSX::MAX_COLS - destCol > leftColOffset + widthCols ) {
+                anchorLeftCol  = (destCol - 1) + leftColOffset;
+                anchorRightCol = (destCol - 1) + leftColOffset + widthCols;
+            }
+            else { // if anchor would overflow MAX_COLS: move column anchor to the left of destCol
+                anchorLeftCol  = (destCol - 1) - leftColOffset - widthCols;
+                anchorRightCol = (destCol - 1) - leftColOffset;
+            }
+
+            uint32_t anchorTopRow, anchorBottomRow;
+            if( OpenXLSX::MAX_ROWS - destRow > topRowOffset + heightRows ) {
+                anchorTopRow    = (destRow - 1) + topRowOffset;
+                anchorBottomRow = (destRow - 1) + topRowOffset + heightRows;
+            }
+            else { // if anchor would overflow MAX_ROWS: move row anchor to the top of destCol
+                anchorTopRow    = (destRow - 1) - topRowOffset - heightRows;
+                anchorBottomRow = (destRow - 1) - topRowOffset;
+            }
+            if (anchorRightCol > MAX_SHAPE_ANCHOR_COLUMN)
+                std::cout << "XLComments::set WARNING: anchoring comment shapes beyond column "s
+                /**/          + XLCellReference::columnAsString(MAX_SHAPE_ANCHOR_COLUMN) + " may not get displayed correctly (LO Calc, TBD in Excel)"s << std::endl;
+            if (anchorBottomRow > MAX_SHAPE_ANCHOR_ROW)
+                std::cout << "XLComments::set WARNING: anchoring comment shapes beyond row "s
+                /**/          +                  std::to_string(MAX_SHAPE_ANCHOR_ROW   ) + " may not get displayed correctly (LO Calc, TBD in Excel)"s << std::endl;
+
+            uint16_t anchorLeftOffsetInCell = 10, anchorRightOffsetInCell = 10;
+            uint16_t anchorTopOffsetInCell = 5, anchorBottomOffsetInCell = 5;
+
+            // clientData.setAnchor("3, 23, 0, 0, 4, 25, 3, 5");
+            using namespace std::literals::string_literals;
+            clientData.setAnchor(
+                  std::to_string(anchorLeftCol)           + ","s
+                + std::to_string(anchorLeftOffsetInCell)  + ","s
+                + std::to_string(anchorTopRow)            + ","s
+                + std::to_string(anchorTopOffsetInCell)   + ","s
+                + std::to_string(anchorRightCol)          + ","s
+                + std::to_string(anchorRightOffsetInCell) + ","s
+                + std::to_string(anchorBottomRow)         + ","s
+                + std::to_string(anchorBottomOffsetInCell)
+            );
+        }
+        clientData.setAutoFill(false);
+        clientData.setTextVAlign(XLShapeTextVAlign::Top);
+        clientData.setTextHAlign(XLShapeTextHAlign::Left);
+        clientData.setRow(destRow - 1);    // row and column are zero-indexed in XLShapeClientData
+        clientData.setColumn(destCol - 1); // ..
+
+	// 	<v:shadow on="t" obscured="t" color="black"/>
+	// 	<v:fill o:detectmouseclick="t" type="solid" color2="#00003f"/>
+	// 	<v:stroke color="#3465a4" startarrow="block" startarrowwidth="medium" startarrowlength="medium" joinstyle="round" endcap="flat"/>
+	// 	<x:ClientData ObjectType="Note">
+	// 		<x:MoveWithCells/>
+	// 		<x:SizeWithCells/>
+	// 		<x:Anchor>3, 23, 0, 0, 4, 25, 3, 5</x:Anchor>
+	// 		<x:AutoFill>False</x:AutoFill>
+	// 		<x:TextVAlign>Top</x:TextVAlign>
+	// 		<x:TextHAlign>Left</x:TextHAlign>
+	// 		<x:Row>0</x:Row>
+	// 		<x:Column>2</x:Column>
+	// 	</x:ClientData>
+	// </v:shape>
+    }
 }    // namespace
 
 
@@ -180,7 +291,7 @@ XLComments::XLComments(const XLComments& other)
       // m_vmlDrawing(std::make_unique<XLVmlDrawing>(other.m_vmlDrawing ? *other.m_vmlDrawing : XLVmlDrawing())) // this can be used if other.m_vmlDrawing can be uninitialized
       m_hintNode(other.m_hintNode),
       m_hintIndex(other.m_hintIndex)
-{}
+{}    // m_index is not copied - it will be rebuilt on first use
 
 /**
  * @details move-construct an XLComments object
@@ -191,7 +302,9 @@ XLComments::XLComments(XLComments&& other) noexcept
       m_commentList(std::move(other.m_commentList)),
       m_vmlDrawing(std::move(other.m_vmlDrawing)),
       m_hintNode(other.m_hintNode),
-      m_hintIndex(other.m_hintIndex)
+      m_hintIndex(other.m_hintIndex),
+      m_index(std::move(other.m_index)),
+      m_indexValid(other.m_indexValid)
 {}
 
 /**
@@ -206,6 +319,8 @@ XLComments& XLComments::operator=(XLComments&& other) noexcept
         m_vmlDrawing       = std::move(other.m_vmlDrawing);
         m_hintNode         = std::move(other.m_hintNode);
         m_hintIndex        = other.m_hintIndex;
+        m_index            = std::move(other.m_index);
+        m_indexValid       = other.m_indexValid;
     }
     return *this;
 }
@@ -267,11 +382,44 @@ XMLNode XLComments::commentNode(size_t index) const
 }
 
 /**
- * @details TODO: write doxygen headers for functions in this module
+ * @details find a comment XML node by its cell reference through the index
+ * @return the comment node, or an empty node if cellRef is invalid or has no comment
  */
 XMLNode XLComments::commentNode(const std::string& cellRef) const
 {
-    return m_commentList.find_child_by_attribute("comment", "ref", cellRef.c_str());
+    if (!m_indexValid) buildIndex();
+
+    uint64_t key{};
+    try {
+        XLCellReference ref(cellRef);
+        key = cellKey(ref.row(), ref.column());
+    }
+    catch (XLException const&) {
+        return XMLNode{};
+    }
+    auto found = m_index.find(key);
+    return found != m_index.end() ? found->second : XMLNode{};
+}
+
+/**
+ * @details index all comment nodes by the cell position of their ref attribute - nodes with an invalid ref can not be found
+ *  by cell reference, and of several nodes for the same cell only the first one is found, as with a sequential search
+ */
+void XLComments::buildIndex() const
+{
+    m_index.clear();
+    XMLNode comment = m_commentList.first_child_of_type(pugi::node_element);
+    while (not comment.empty()) {
+        if (std::string_view(comment.name()) == "comment") {    // safeguard against rogue nodes
+            try {
+                XLCellReference ref(comment.attribute("ref").value());
+                m_index.emplace(cellKey(ref.row(), ref.column()), comment);
+            }
+            catch (XLException const&) {} // ignore comments with an invalid ref
+        }
+        comment = comment.next_sibling_of_type(pugi::node_element);
+    }
+    m_indexValid = true;
 }
 
 /**
@@ -375,6 +523,8 @@ bool XLComments::deleteComment(const std::string& cellRef)
     XMLNode comment = commentNode(cellRef);
     if (comment.empty()) return false;
     else {
+        XLCellReference ref(cellRef);                       // commentNode found the comment, so cellRef is valid
+        m_index.erase(cellKey(ref.row(), ref.column()));
         m_commentList.remove_child(comment);
         m_hintNode = XMLNode{}; // reset hint after modification of comment list
         m_hintIndex = 0;
@@ -405,26 +555,27 @@ XLComment XLComments::get(size_t index) const { return XLComment(commentNode(ind
 std::string XLComments::get(const std::string& cellRef) const { return getCommentString(commentNode(cellRef)); }
 
 /**
- * @details TODO: write doxygen headers for functions in this module
+ * @details find the comment node for the cell at row, column via the index or insert a new one at its sorted position
+ * @param created is set to true if a new comment node was inserted, false if an existing one was found
+ * @return the comment node, with its previous content still in place if it existed
  */
-bool XLComments::set(std::string const& cellRef, std::string const& commentText, uint16_t authorId_)
+XMLNode XLComments::insertCommentNode(uint32_t row, uint16_t column, bool& created)
 {
-    XLCellReference destRef(cellRef);
-    uint32_t destRow = destRef.row();
-    uint16_t destCol = destRef.column();
-    bool newCommentCreated = false; // if false, try to find an existing shape before creating one
+    if (!m_indexValid) buildIndex();
 
-    using namespace std::literals::string_literals;
-    XMLNode comment = m_commentList.first_child_of_type(pugi::node_element);
-    while (not comment.empty()) {
-        if (comment.name() == "comment"s) { // safeguard against rogue nodes
-            XLCellReference ref(comment.attribute("ref").value());
-            if (ref.row() > destRow ||(ref.row() == destRow && ref.column() >= destCol)) // abort when node or a node behind it is found
-    break;
-        }
-        comment = comment.next_sibling_of_type(pugi::node_element);
+    uint64_t key = cellKey(row, column);
+    auto next = m_index.lower_bound(key);
+    if (next != m_index.end() && next->first == key) {   // node exists / was found
+        created = false;
+        return next->second;
+    }
+
+    XMLNode comment{};
+    if (next != m_index.end()) {                                                 // if node has to be inserted *before* another one
+        comment = m_commentList.insert_child_before("comment", next->second);         // insert new comment
+        copyLeadingWhitespaces(m_commentList, comment, comment.next_sibling());        // and copy whitespaces prefix from next node
     }
-    if(comment.empty()) {                                                     // no comments yet or this will be the last comment
+    else {                                                                       // no comments yet or this will be the last comment
         comment = m_commentList.last_child_of_type(pugi::node_element);
         if (comment.empty()) {                                                   // if this is the only comment so far
             comment = m_commentList.prepend_child("comment");                                   // prepend new comment
@@ -434,32 +585,51 @@ bool XLComments::set(std::string const& cellRef, std::string const& commentText,
             comment = m_commentList.insert_child_after("comment", comment);                     // insert new comment at end of list
             copyLeadingWhitespaces(m_commentList, comment.previous_sibling(), comment);         // and copy whitespaces prefix from previous comment
         }
-        newCommentCreated = true;
     }
-    else {
-        XLCellReference ref(comment.attribute("ref").value());
-        if(ref.row() != destRow || ref.column() != destCol) {                 // if node has to be inserted *before* this one
-            comment = m_commentList.insert_child_before("comment", comment);        // insert new comment
-            copyLeadingWhitespaces(m_commentList, comment, comment.next_sibling()); // and copy whitespaces prefix from next node
-            newCommentCreated = true;
+    m_index.emplace_hint(next, key, comment);
+    created = true;
+
+    // ===== The list of nodes was modified: re-set m_hintNode that is used to access nodes by index
+    m_hintNode = XMLNode{};
+    m_hintIndex = 0;
+
+    return comment;
+}
+
+/**
+ * @details locate the shape for the cell at row, column - building shapeIndex from all shapes in the VML drawing on first use
+ * @return the shape node, or an empty node if none was found
+ */
+XMLNode XLComments::shapeNodeIndexed(uint32_t row, uint16_t column, std::map<uint64_t, XMLNode>& shapeIndex, bool& shapesIndexed) const
+{
+    if (!shapesIndexed) {
+        XMLNode node = m_vmlDrawing->firstShapeNode();
+        while (not node.empty()) {
+            if (node.raw_name() == ShapeNodeName) {
+                XMLNode clientData = node.child("x:ClientData");   // x:Row and x:Column are zero-indexed
+                shapeIndex.emplace(cellKey(clientData.child("x:Row").text().as_uint() + 1,
+                                           static_cast<uint16_t>(clientData.child("x:Column").text().as_uint() + 1)), node);
+            }
+            node = node.next_sibling_of_type(pugi::node_element);
         }
-        else // node exists / was found
-            comment.remove_children();    // clear node content
+        shapesIndexed = true;
     }
+    auto found = shapeIndex.find(cellKey(row, column));
+    return found != shapeIndex.end() ? found->second : XMLNode{};
+}
 
-    // ===== If the list of nodes was modified, re-set m_hintNode that is used to access nodes by index
-    if (newCommentCreated) {
-        m_hintNode = XMLNode{}; // reset hint after modification of comment list
-        m_hintIndex = 0;
-    }
+/**
+ * @details insert or update the comment node for cellRef through the index, then create or update its shape
+ */
+bool XLComments::set(std::string const& cellRef, std::string const& commentText, uint16_t authorId_)
+{
+    XLCellReference destRef(cellRef);
+    uint32_t destRow = destRef.row();
+    uint16_t destCol = destRef.column();
 
-    // now that we have a valid comment node: update attributes and content
-    if (comment.attribute("ref").empty())                                  // if ref has to be created
-        comment.append_attribute("ref").set_value(destRef.address().c_str()); // then do so - otherwise it can remain untouched
-    appendAndSetAttribute(comment, "authorId", std::to_string(authorId_)); // update authorId
-    XMLNode tNode = comment.prepend_child("text").prepend_child("t");      // insert <text><t/></text> nodes
-    tNode.append_attribute("xml:space").set_value("preserve");             // set <t> node attribute xml:space
-    tNode.prepend_child(pugi::node_pcdata).set_value(commentText.c_str()); // finally, insert <t> node_pcdata value
+    bool newCommentCreated = false; // if false, try to find an existing shape before creating one
+    XMLNode comment = insertCommentNode(destRow, destCol, newCommentCreated);
+    setCommentContent(comment, destRef.address(), commentText, authorId_);
 
     if (m_vmlDrawing->valid()) {
         XLShape cShape{};
@@ -474,90 +644,7 @@ bool XLComments::set(std::string const& cellRef, std::string const& commentText,
         }
         if (newShapeNeeded)
             cShape = m_vmlDrawing->createShape();
-
-        cShape.setFillColor("#ffffc0");
-        cShape.setStroked(true);
-        // setType: already done by XLVmlDrawing::createShape
-        cShape.setAllowInCell(false);
-        {
-            // XLShapeStyle shapeStyle("position:absolute;margin-left:100pt;margin-top:0pt;width:50pt;height:50.0pt;mso-wrap-style:none;v-text-anchor:middle;visibility:hidden");
-            XLShapeStyle shapeStyle{}; // default construct with meaningful values
-            cShape.setStyle(shapeStyle);
-        }
-
-        XLShapeClientData clientData = cShape.clientData();
-        clientData.setObjectType("Note");
-        clientData.setMoveWithCells();
-        clientData.setSizeWithCells();
-
-        {
-            constexpr const uint16_t leftColOffset = 1;
-            constexpr const uint16_t widthCols = 2;
-            constexpr const uint16_t topRowOffset = 1;
-            constexpr const uint16_t heightRows = 2;
-
-            uint16_t anchorLeftCol, anchorRightCol;
-            if( OpenXLSX::MAX_COLS - destCol > leftColOffset + widthCols ) {
-                anchorLeftCol  = (destCol - 1) + leftColOffset;
-                anchorRightCol = (destCol - 1) + leftColOffset + widthCols;
-            }
-            else { // if anchor would overflow MAX_COLS: move column anchor to the left of destCol
-                anchorLeftCol  = (destCol - 1) - leftColOffset - widthCols;
-                anchorRightCol = (destCol - 1) - leftColOffset;
-            }
-
-            uint32_t anchorTopRow, anchorBottomRow;
-            if( OpenXLSX::MAX_ROWS - destRow > topRowOffset + heightRows ) {
-                anchorTopRow    = (destRow - 1) + topRowOffset;
-                anchorBottomRow = (destRow - 1) + topRowOffset + heightRows;
-            }
-            else { // if anchor would overflow MAX_ROWS: move row anchor to the top of destCol
-                anchorTopRow    = (destRow - 1) - topRowOffset - heightRows;
-                anchorBottomRow = (destRow - 1) - topRowOffset;
-            }
-            if (anchorRightCol > MAX_SHAPE_ANCHOR_COLUMN)
-                std::cout << "XLComments::set WARNING: anchoring comment shapes beyond column "s
-                /**/          + XLCellReference::columnAsString(MAX_SHAPE_ANCHOR_COLUMN) + " may not get displayed correctly (LO Calc, TBD in Excel)"s << std::endl;
-            if (anchorBottomRow > MAX_SHAPE_ANCHOR_ROW)
-                std::cout << "XLComments::set WARNING: anchoring comment shapes beyond row "s
-                /**/          +                  std::to_string(MAX_SHAPE_ANCHOR_ROW   ) + " may not get displayed correctly (LO Calc, TBD in Excel)"s << std::endl;
-
-            uint16_t anchorLeftOffsetInCell = 10, anchorRightOffsetInCell = 10;
-            uint16_t anchorTopOffsetInCell = 5, anchorBottomOffsetInCell = 5;
-
-            // clientData.setAnchor("3, 23, 0, 0, 4, 25, 3, 5");
-            using namespace std::literals::string_literals;
-            clientData.setAnchor(
-                  std::to_string(anchorLeftCol)           + ","s
-                + std::to_string(anchorLeftOffsetInCell)  + ","s
-                + std::to_string(anchorTopRow)            + ","s
-                + std::to_string(anchorTopOffsetInCell)   + ","s
-                + std::to_string(anchorRightCol)          + ","s
-                + std::to_string(anchorRightOffsetInCell) + ","s
-                + std::to_string(anchorBottomRow)         + ","s
-                + std::to_string(anchorBottomOffsetInCell)
-            );
-        }
-        clientData.setAutoFill(false);
-        clientData.setTextVAlign(XLShapeTextVAlign::Top);
-        clientData.setTextHAlign(XLShapeTextHAlign::Left);
-        clientData.setRow(destRow - 1);    // row and column are zero-indexed in XLShapeClientData
-        clientData.setColumn(destCol - 1); // ..
-
-	// 	<v:shadow on="t" obscured="t" color="black"/>
-	// 	<v:fill o:detectmouseclick="t" type="solid" color2="#00003f"/>
-	// 	<v:stroke color="#3465a4" startarrow="block" startarrowwidth="medium" startarrowlength="medium" joinstyle="round" endcap="flat"/>
-	// 	<x:ClientData ObjectType="Note">
-	// 		<x:MoveWithCells/>
-	// 		<x:SizeWithCells/>
-	// 		<x:Anchor>3, 23, 0, 0, 4, 25, 3, 5</x:Anchor>
-	// 		<x:AutoFill>False</x:AutoFill>
-	// 		<x:TextVAlign>Top</x:TextVAlign>
-	// 		<x:TextHAlign>Left</x:TextHAlign>
-	// 		<x:Row>0</x:Row>
-	// 		<x:Column>2</x:Column>
-	// 	</x:ClientData>
-	// </v:shape>
+        formatCommentShape(cShape, destRow, destCol);
     }
     else
         throw XLException("XLComments::set: can not set (format) any comments when VML Drawing object is invalid");
@@ -565,6 +652,47 @@ bool XLComments::set(std::string const& cellRef, std::string const& commentText,
     return true;
 }
 
+/**
+ * @details Parse all cell references before modifying anything, then process the comments in cell order so that each new
+ *  comment is either appended behind the previous one or inserted in front of its successor found through the index, and
+ *  new shapes are appended to the VML drawing in the same order. Shapes of existing comments are located through an index
+ *  of the VML drawing that is built once, on the first update of an existing comment.
+ */
+bool XLComments::set(std::vector<XLCommentEntry> const& comments)
+{
+    if (!m_vmlDrawing->valid())
+        throw XLException("XLComments::set: can not set (format) any comments when VML Drawing object is invalid");
+
+    std::vector<std::pair<uint64_t, size_t>> order;   // cell position, index in comments
+    order.reserve(comments.size());
+    for (size_t i = 0; i < comments.size(); ++i) {
+        XLCellReference destRef(comments[i].ref);      // throws on an invalid address, before any modification
+        order.emplace_back(cellKey(destRef.row(), destRef.column()), i);
+    }
+    std::stable_sort(order.begin(), order.end(), [](auto const& a, auto const& b) { return a.first < b.first; });
+
+    std::map<uint64_t, XMLNode> shapeIndex{};
+    bool shapesIndexed = false;
+    for (size_t pos = 0; pos < order.size(); ++pos) {
+        if (pos + 1 < order.size() && order[pos + 1].first == order[pos].first)
+            continue;                                  // a later entry for the same cell takes precedence
+
+        uint32_t destRow = static_cast<uint32_t>(order[pos].first >> 16);
+        uint16_t destCol = static_cast<uint16_t>(order[pos].first & 0xffff);
+        XLCommentEntry const& entry = comments[order[pos].second];
+
+        bool newCommentCreated = false;
+        XMLNode comment = insertCommentNode(destRow, destCol, newCommentCreated);
+        setCommentContent(comment, XLCellReference(destRow, destCol).address(), entry.text, entry.authorId);
+
+        XMLNode shapeNode{};
+        if (!newCommentCreated) shapeNode = shapeNodeIndexed(destRow, destCol, shapeIndex, shapesIndexed);
+        XLShape cShape = shapeNode.empty() ? m_vmlDrawing->createShape() : XLShape(shapeNode);
+        formatCommentShape(cShape, destRow, destCol);
+    }
+    return true;
+}
+
 /**
  * @details
  */
@@ -298,7 +298,10 @@ void XLContentTypes::addOverride(const std::string& path, XLContentType type)
  */
 void XLContentTypes::deleteOverride(const std::string& path)
 {
-    xmlDocument().document_element().remove_child(xmlDocument().document_element().find_child_by_attribute("PartName", path.c_str()));
+    XLNodeIndex*  partNameIndex = m_xmlData->getNodeIndex("PartName");
+    const XMLNode contentItem   = partNameIndex->findNode(xmlDocument().document_element(), path);
+    partNameIndex->eraseNode(contentItem);
+    xmlDocument().document_element().remove_child(contentItem);
 }
 
 /**
@@ -311,7 +314,7 @@ void XLContentTypes::deleteOverride(const XLContentItem& item) { deleteOverride(
  */
 XLContentItem XLContentTypes::contentItem(const std::string& path)
 {
-    return XLContentItem(xmlDocument().document_element().find_child_by_attribute("PartName", path.c_str()));
+    return XLContentItem(m_xmlData->getNodeIndex("PartName")->findNode(xmlDocument().document_element(), path));
 }
 
 /**
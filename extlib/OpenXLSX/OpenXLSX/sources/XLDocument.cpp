@@ -45,6 +45,8 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 
 // ===== External Includes ===== //
 #include <algorithm>
+#include <atomic>
+#include <exception>
 #ifdef ENABLE_NOWIDE
 #    include <nowide/fstream.hpp>
 #endif
@@ -53,6 +55,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #endif
 #include <pugixml.hpp>
 #include <sys/stat.h>     // for stat, to test if a file exists and if a file is a directory
+#include <thread>
 #include <vector>         // std::vector
 
 // ===== OpenXLSX Includes ===== //
@@ -468,7 +471,7 @@ void XLDocument::suppressWarnings() { m_suppressWarnings = true; }
  * - Unzip the contents of the package to the temporary folder.
  * - load the contents into the data structure for manipulation.
  */
-void XLDocument::open(const std::string& fileName)
+void XLDocument::open(const std::string& fileName, const XLOpenOptions& options)
 {
     // Check if a document is already open. If yes, close it.
     if (m_archive.isOpen()) close(); // TBD: consider throwing if a file is already open.
@@ -477,8 +480,8 @@ void XLDocument::open(const std::string& fileName)
 
     // ===== Add and open the Relationships and [Content_Types] files for the document level.
     std::string relsFilename = "_rels/.rels";
-    m_data.emplace_back(this, "[Content_Types].xml");
-    m_data.emplace_back(this, relsFilename);
+    addXmlData("[Content_Types].xml");
+    addXmlData(relsFilename);
 
     m_contentTypes     = XLContentTypes(getXmlData("[Content_Types].xml"));
     m_docRelationships = XLRelationships(getXmlData(relsFilename), relsFilename);
@@ -488,7 +491,7 @@ void XLDocument::open(const std::string& fileName)
         if (item.type() == XLRelationshipType::Workbook) {
             workbookPath = item.target();
             if( workbookPath[ 0 ] == '/' ) workbookPath = workbookPath.substr(1); // NON STANDARD FORMATS: strip leading '/'
-            m_data.emplace_back(this, workbookPath, item.id(), XLContentType::Workbook);
+            addXmlData(workbookPath, item.id(), XLContentType::Workbook);
             workbookAdded = true;
     break;
         }
@@ -501,7 +504,7 @@ void XLDocument::open(const std::string& fileName)
         throw XLInputError(std::string("workbook path from "s + relsFilename + " has no folder name: "s) + workbookPath);
     }
     std::string workbookRelsFilename = std::string("xl/_rels/") + workbookPath.substr(pos + 1) + std::string(".rels");
-    m_data.emplace_back(this, workbookRelsFilename); // m_data.emplace_back(this, "xl/_rels/workbook.xml.rels");
+    addXmlData(workbookRelsFilename); // addXmlData("xl/_rels/workbook.xml.rels");
     m_wbkRelationships = XLRelationships(getXmlData(workbookRelsFilename), workbookRelsFilename);
 
     // ===== Create xl/styles.xml if missing
@@ -536,10 +539,9 @@ void XLDocument::open(const std::string& fileName)
                    ||(item.path().substr(4)     == "styles.xml")
                    ||(item.path().substr(4, 11) == "theme/theme"))
             {
-                m_data.emplace_back(/* parentDoc */ this,
-                                    /* xmlPath   */ item.path().substr(1),
-                                    /* xmlID     */ m_wbkRelationships.relationshipByTarget(item.path().substr(4)).id(),
-                                    /* xmlType   */ item.type());
+                addXmlData(/* xmlPath   */ item.path().substr(1),
+                           /* xmlID     */ m_wbkRelationships.relationshipByTarget(item.path().substr(4)).id(),
+                           /* xmlType   */ item.type());
             }
             else {
                 if( !m_suppressWarnings )
@@ -552,10 +554,9 @@ void XLDocument::open(const std::string& fileName)
                 std::cerr << "adding missing workbook relationship to _rels/.rels" << std::endl;
                 m_docRelationships.addRelationship(XLRelationshipType::Workbook, workbookPath);    // Pull request #185: Fix missing workbook relationship
             }
-            m_data.emplace_back(/* parentDoc */ this,
-                                /* xmlPath   */ item.path().substr(1),
-                                /* xmlID     */ m_docRelationships.relationshipByTarget(item.path().substr(1)).id(),
-                                /* xmlType   */ item.type());
+            addXmlData(/* xmlPath   */ item.path().substr(1),
+                       /* xmlID     */ m_docRelationships.relationshipByTarget(item.path().substr(1)).id(),
+                       /* xmlType   */ item.type());
         }
     }
 
@@ -619,8 +620,12 @@ void XLDocument::open(const std::string& fileName)
     // ===== 2024-09-02: ensure that all worksheets are contained in app.xml <TitlesOfParts> and reflected in <HeadingPairs> value for Worksheets
     m_appProperties.alignWorksheets(m_workbook.sheetNames());
 
-    m_sharedStrings  = XLSharedStrings(getXmlData("xl/sharedStrings.xml"), &m_sharedStringCache);
+    m_sharedStrings  = XLSharedStrings(getXmlData("xl/sharedStrings.xml"), &m_sharedStringCache, &m_sharedStringIndex);
+    m_sharedStrings.rebuildIndex();
     m_styles         = XLStyles(getXmlData("xl/styles.xml"), m_suppressWarnings); // 2024-10-14: forward supress warnings setting to XLStyles
+
+    // ===== Opt-in: parse all worksheets now instead of on first access
+    if (options.parseWorksheets) parseWorksheets(options.threadCount);
 }
 
 namespace {
@@ -712,7 +717,9 @@ void XLDocument::close()
     m_xmlSavingDeclaration = XLXmlSavingDeclaration();
 
     m_data.clear();
+    m_dataIndex.clear();
     m_sharedStringCache.clear();             // 2024-12-18 BUGFIX: clear shared strings cache - addresses issue #283
+    m_sharedStringIndex.clear();
     m_sharedStrings    = XLSharedStrings();  //
 
     m_docRelationships = XLRelationships();
@@ -728,14 +735,16 @@ void XLDocument::close()
 /**
  * @details Save the document with the same name. The existing file will be overwritten.
  */
-void XLDocument::save() { saveAs(m_filePath, XLForceOverwrite); }
+void XLDocument::save(const XLZipSaveOptions& options) { saveAs(m_filePath, XLForceOverwrite, options); }
 
 /**
  * @details Save the document with a new name. If present, the 'calcChain.xml file will be ignored. The reason for this
  * is that changes to the document may invalidate the calcChain.xml file. Deleting will force Excel to re-create the
  * file. This will happen automatically, without the user noticing.
+ * Only XML parts that have been parsed or set are serialized; the cost of saving is proportional to the parts touched.
+ * The serialized parts are compressed in parallel according to options.
  */
-void XLDocument::saveAs(const std::string& fileName, bool forceOverwrite)
+void XLDocument::saveAs(const std::string& fileName, bool forceOverwrite, const XLZipSaveOptions& options)
 {
     // 2024-07-26: prevent silent overwriting of existing files
     if (!forceOverwrite && pathExists(fileName)) {
@@ -749,8 +758,10 @@ void XLDocument::saveAs(const std::string& fileName, bool forceOverwrite)
     // TODO: Is this the best way to do it? Maybe there is a flag that can be set, that forces re-calculalion.
     execCommand(XLCommand(XLCommandType::ResetCalcChain));
 
-    // ===== Add all xml items to archive and save the archive.
+    // ===== Add all modified xml items to archive and save the archive. Parts that were never parsed are still
+    // ===== identical to their archive entry, which is then copied through without decompressing and recompressing it.
     for (auto& item : m_data) {
+        if (!item.isDirty() && m_archive.hasEntry(item.getXmlPath())) continue;
         bool xmlIsStandalone = m_xmlSavingDeclaration.standalone_as_bool();
         if ((item.getXmlPath() == "docProps/core.xml")
           ||(item.getXmlPath() == "docProps/app.xml"))
@@ -758,7 +769,7 @@ void XLDocument::saveAs(const std::string& fileName, bool forceOverwrite)
         m_archive.addEntry(item.getXmlPath(),
             item.getRawData(XLXmlSavingDeclaration(m_xmlSavingDeclaration.version(), m_xmlSavingDeclaration.encoding(),xmlIsStandalone)));
     }
-    m_archive.save(m_filePath);
+    m_archive.save(m_filePath, options);
 }
 
 /**
@@ -1079,7 +1090,7 @@ XLRelationships XLDocument::sheetRelationships(uint16_t sheetXmlNo)
     constexpr const bool DO_NOT_THROW = true;
     XLXmlData *xmlData = getXmlData(relsFilename, DO_NOT_THROW);
     if (xmlData == nullptr) // if not yet managed: add the sheet relationships file to the managed files
-        xmlData = &m_data.emplace_back(this, relsFilename, "", XLContentType::Relationships);
+        xmlData = &addXmlData(relsFilename, "", XLContentType::Relationships);
 
     return XLRelationships(xmlData, relsFilename);
 }
@@ -1100,7 +1111,7 @@ XLVmlDrawing XLDocument::sheetVmlDrawing(uint16_t sheetXmlNo)
     constexpr const bool DO_NOT_THROW = true;
     XLXmlData *xmlData = getXmlData(vmlDrawingFilename, DO_NOT_THROW);
     if (xmlData == nullptr) // if not yet managed: add the sheet drawing file to the managed files
-        xmlData = &m_data.emplace_back(this, vmlDrawingFilename, "", XLContentType::VMLDrawing);
+        xmlData = &addXmlData(vmlDrawingFilename, "", XLContentType::VMLDrawing);
 
     return XLVmlDrawing(xmlData);
 }
@@ -1121,7 +1132,7 @@ XLComments XLDocument::sheetComments(uint16_t sheetXmlNo)
     constexpr const bool DO_NOT_THROW = true;
     XLXmlData *xmlData = getXmlData(commentsFilename, DO_NOT_THROW);
     if (xmlData == nullptr) // if not yet managed: add the sheet comments file to the managed files
-        xmlData = &m_data.emplace_back(this, commentsFilename, "", XLContentType::Comments);
+        xmlData = &addXmlData(commentsFilename, "", XLContentType::Comments);
 
     return XLComments(xmlData);
 }
@@ -1142,7 +1153,7 @@ XLTables XLDocument::sheetTables(uint16_t sheetXmlNo)
     constexpr const bool DO_NOT_THROW = true;
     XLXmlData *xmlData = getXmlData(tablesFilename, DO_NOT_THROW);
     if (xmlData == nullptr) // if not yet managed: add the sheet tables file to the managed files
-        xmlData = &m_data.emplace_back(this, tablesFilename, "", XLContentType::Table);
+        xmlData = &addXmlData(tablesFilename, "", XLContentType::Table);
 
     return XLTables(xmlData);
 }
@@ -1233,10 +1244,7 @@ bool XLDocument::execCommand(const XLCommand& command)
 
         case XLCommandType::ResetCalcChain: {
             m_archive.deleteEntry("xl/calcChain.xml");
-            const auto item =
-                std::find_if(m_data.begin(), m_data.end(), [&](const XLXmlData& theItem) { return theItem.getXmlPath() == "xl/calcChain.xml"; });
-
-            if (item != m_data.end()) m_data.erase(item);
+            eraseXmlData("xl/calcChain.xml");
         } break;
         case XLCommandType::CheckAndFixCoreProperties: {    // does nothing if core properties are in good shape
             // ===== If _rels/.rels has no entry for docProps/core.xml
@@ -1251,8 +1259,7 @@ bool XLDocument::execCommand(const XLCommand& command)
             // ===== If [Content Types].xml has no relationship for docProps/core.xml
             if (!hasXmlData("docProps/core.xml")) {
                 m_contentTypes.addOverride("/docProps/core.xml", XLContentType::CoreProperties);    // add content types entry
-                m_data.emplace_back(                                                                // store new entry in m_data
-                    /* parentDoc */ this,
+                addXmlData(                                                                         // store new entry in m_data
                     /* xmlPath   */ "docProps/core.xml",
                     /* xmlID     */ m_docRelationships.relationshipByTarget("docProps/core.xml").id(),
                     /* xmlType   */ XLContentType::CoreProperties);
@@ -1271,8 +1278,7 @@ bool XLDocument::execCommand(const XLCommand& command)
             // ===== If [Content Types].xml has no relationship for docProps/app.xml
             if (!hasXmlData("docProps/app.xml")) {
                 m_contentTypes.addOverride("/docProps/app.xml", XLContentType::ExtendedProperties);    // add content types entry
-                m_data.emplace_back(                                                                   // store new entry in m_data
-                    /* parentDoc */ this,
+                addXmlData(                                                                            // store new entry in m_data
                     /* xmlPath   */ "docProps/app.xml",
                     /* xmlID     */ m_docRelationships.relationshipByTarget("docProps/app.xml").id(),
                     /* xmlType   */ XLContentType::ExtendedProperties);
@@ -1305,8 +1311,7 @@ bool XLDocument::execCommand(const XLCommand& command)
             m_wbkRelationships.addRelationship(XLRelationshipType::Worksheet, command.getParam<std::string>("sheetPath").substr(4));
             m_appProperties.appendSheetName(command.getParam<std::string>("sheetName"));
             m_archive.addEntry(command.getParam<std::string>("sheetPath").substr(1), emptyWorksheet);
-            m_data.emplace_back(
-                /* parentDoc */ this,
+            addXmlData(
                 /* xmlPath   */ command.getParam<std::string>("sheetPath").substr(1),
                 /* xmlID     */ m_wbkRelationships.relationshipByTarget(command.getParam<std::string>("sheetPath").substr(4)).id(),
                 /* xmlType   */ XLContentType::Worksheet);
@@ -1321,9 +1326,7 @@ bool XLDocument::execCommand(const XLCommand& command)
             m_archive.deleteEntry(sheetPath.substr(1));
             m_contentTypes.deleteOverride(sheetPath);
             m_wbkRelationships.deleteRelationship(command.getParam<std::string>("sheetID"));
-            m_data.erase(std::find_if(m_data.begin(), m_data.end(), [&](const XLXmlData& item) {
-                return item.getXmlPath() == sheetPath.substr(1);
-            }));
+            eraseXmlData(sheetPath.substr(1));
         } break;
         case XLCommandType::CloneSheet: {
             validateSheetName(command.getParam<std::string>("cloneName"), THROW_ON_INVALID);
@@ -1340,12 +1343,8 @@ bool XLDocument::execCommand(const XLCommand& command)
                 m_contentTypes.addOverride(sheetPath, XLContentType::Worksheet);
                 m_wbkRelationships.addRelationship(XLRelationshipType::Worksheet, sheetPath.substr(4));
                 m_appProperties.appendSheetName(command.getParam<std::string>("cloneName"));
-                m_archive.addEntry(sheetPath.substr(1),
-                                   std::find_if(m_data.begin(), m_data.end(), [&](const XLXmlData& data) {
-                                       return data.getXmlPath().substr(3) == sheetToClonePath; // 2024-12-15: ensure relative sheet path
-                                   })->getRawData());
-                m_data.emplace_back(
-                    /* parentDoc */ this,
+                m_archive.addEntry(sheetPath.substr(1), getXmlData("xl/" + sheetToClonePath)->getRawData()); // 2024-12-15: ensure relative sheet path
+                addXmlData(
                     /* xmlPath   */ sheetPath.substr(1),
                     /* xmlID     */ m_wbkRelationships.relationshipByTarget(sheetPath.substr(4)).id(),
                     /* xmlType   */ XLContentType::Worksheet);
@@ -1354,12 +1353,8 @@ bool XLDocument::execCommand(const XLCommand& command)
                 m_contentTypes.addOverride(sheetPath, XLContentType::Chartsheet);
                 m_wbkRelationships.addRelationship(XLRelationshipType::Chartsheet, sheetPath.substr(4));
                 m_appProperties.appendSheetName(command.getParam<std::string>("cloneName"));
-                m_archive.addEntry(sheetPath.substr(1),
-                                   std::find_if(m_data.begin(), m_data.end(), [&](const XLXmlData& data) {
-                                       return data.getXmlPath().substr(3) == sheetToClonePath; // 2024-12-15: ensure relative sheet path
-                                   })->getRawData());
-                m_data.emplace_back(
-                    /* parentDoc */ this,
+                m_archive.addEntry(sheetPath.substr(1), getXmlData("xl/" + sheetToClonePath)->getRawData()); // 2024-12-15: ensure relative sheet path
+                addXmlData(
                     /* xmlPath   */ sheetPath.substr(1),
                     /* xmlID     */ m_wbkRelationships.relationshipByTarget(sheetPath.substr(4)).id(),
                     /* xmlType   */ XLContentType::Chartsheet);
@@ -1430,12 +1425,10 @@ XLQuery XLDocument::execQuery(const XLQuery& query) const
             return XLQuery(query).setResult(m_sharedStrings);
 
         case XLQueryType::QueryXmlData: {
-            const auto result = std::find_if(m_data.begin(), m_data.end(), [&](const XLXmlData& item) {
-                return item.getXmlPath() == query.getParam<std::string>("xmlPath");
-            });
-            if (result == m_data.end())
+            const auto result = m_dataIndex.find(query.getParam<std::string>("xmlPath"));
+            if (result == m_dataIndex.end())
                 throw XLInternalError("Path does not exist in zip archive (" + query.getParam<std::string>("xmlPath") + ")");
-            return XLQuery(query).setResult(&*result);
+            return XLQuery(query).setResult(&*result->second);
         }
         default:
             throw XLInternalError("XLDocument::execQuery: unknown query type " + std::to_string(static_cast<uint8_t>(query.type())));
@@ -1499,6 +1492,7 @@ void XLDocument::cleanupSharedStrings()
         if (int32_t newIdx = indexMap[oldIdx]; newIdx > 0)           // if string is still in use
             newStringCache[newIdx] = std::move(m_sharedStringCache[oldIdx]); // NOTE: std::move invalidates the shared string cache -> not thread safe
     }
+    m_sharedStringIndex.clear(); // keys are views into m_sharedStringCache
     m_sharedStringCache.clear(); // TBD: is this safe with strings that were std::move assigned to newStringCache?
     // refill m_sharedStringCache cache from newStringCache
     std::move(
@@ -1506,6 +1500,7 @@ void XLDocument::cleanupSharedStrings()
         newStringCache.end(),
         std::back_inserter(m_sharedStringCache)
     );
+    m_sharedStrings.rebuildIndex();
     if (static_cast<int32_t>(newStringCache.size()) != m_sharedStrings.rewriteXmlFromCache())
         throw XLInternalError("XLDocument::cleanupSharedStrings: failed to rewrite shared string table - document would be corrupted");
 }
@@ -1515,11 +1510,64 @@ void XLDocument::cleanupSharedStrings()
 //----------------------------------------------------------------------------------------------------------------------
 
 /**
- * @details
+ * @details The buffer is allocated with pugixml's allocator, so that the document can take ownership of it: the entry is
+ * decompressed once and parsed in place, instead of being copied into a std::string and copied again by load_string.
  */
-std::string XLDocument::extractXmlFromArchive(const std::string& path)
+void XLDocument::extractXmlFromArchive(const std::string& path, XMLDocument& xmlDocument)
 {
-    return (m_archive.hasEntry(path) ? m_archive.getEntry(path) : "");
+    if (!m_archive.hasEntry(path)) {
+        xmlDocument.load_string("", pugi_parse_settings);
+        return;
+    }
+
+    size_t size   = 0;
+    void*  buffer = m_archive.getEntryBuffer(path, size, pugi::get_memory_allocation_function(), pugi::get_memory_deallocation_function());
+    xmlDocument.load_buffer_inplace_own(buffer, size, pugi_parse_settings, pugi::encoding_utf8);
+}
+
+/**
+ * @details The worksheet entries are first decompressed into memory concurrently, each thread using its own reader on the
+ * archive file. Each worksheet is then parsed into its own XMLDocument, which requires no synchronization: each parsing
+ * thread only takes over the decompressed data of its own entry, and the XML namespace support of XMLNode uses
+ * thread_local storage.
+ */
+void XLDocument::parseWorksheets(unsigned threadCount)
+{
+    if (threadCount == 0) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    std::vector<const XLXmlData*> worksheets;
+    std::vector<std::string>      paths;
+    for (const auto& item : m_data) {
+        if (item.getXmlType() != XLContentType::Worksheet) continue;
+        worksheets.push_back(&item);
+        paths.push_back(item.getXmlPath());
+    }
+    if (worksheets.empty()) return;
+
+    m_archive.prefetchEntries(paths, threadCount);
+
+    std::atomic<size_t> next { 0 };
+    std::atomic<bool>   failed { false };
+    std::exception_ptr  error;
+    auto worker = [&]() {
+        for (size_t i = next++; i < worksheets.size() && !failed; i = next++) {
+            try {
+                worksheets[i]->loadXmlDocument();
+            }
+            catch (...) {
+                if (!failed.exchange(true)) error = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    const size_t extraThreads = std::min<size_t>(threadCount, worksheets.size()) - 1;
+    threads.reserve(extraThreads);
+    for (size_t i = 0; i < extraThreads; ++i) threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads) thread.join();
+
+    if (error) std::rethrow_exception(error);
 }
 
 /**
@@ -1536,20 +1584,40 @@ XLXmlData* XLDocument::getXmlData(const std::string& path, bool doNotThrow)
  */
 const XLXmlData* XLDocument::getXmlData(const std::string& path, bool doNotThrow) const
 {
-    std::list<XLXmlData>::iterator result = std::find_if(m_data.begin(), m_data.end(), [&](const XLXmlData& item) { return item.getXmlPath() == path; });
-    if (result == m_data.end()) {
+    const auto result = m_dataIndex.find(path);
+    if (result == m_dataIndex.end()) {
         if (doNotThrow) return nullptr; // use with caution
         else throw XLInternalError("Path " + path + " does not exist in zip archive.");
     }
-    return &*result;
+    return &*result->second;
+}
+
+/**
+ * @details
+ */
+bool XLDocument::hasXmlData(const std::string& path) const { return m_dataIndex.find(path) != m_dataIndex.end(); }
+
+/**
+ * @details Should m_data ever hold two objects for the same path, the index keeps the first one, which is the one a
+ * linear search would have found.
+ */
+XLXmlData& XLDocument::addXmlData(const std::string& path, const std::string& xmlId, XLContentType xmlType)
+{
+    const auto item = m_data.emplace(m_data.end(), this, path, xmlId, xmlType);
+    m_dataIndex.emplace(path, item);
+    return *item;
 }
 
 /**
  * @details
  */
-bool XLDocument::hasXmlData(const std::string& path) const
+void XLDocument::eraseXmlData(const std::string& path)
 {
-    return std::find_if(m_data.begin(), m_data.end(), [&](const XLXmlData& item) { return item.getXmlPath() == path; }) != m_data.end();
+    const auto result = m_dataIndex.find(path);
+    if (result == m_dataIndex.end()) return;
+
+    m_data.erase(result->second);
+    m_dataIndex.erase(result);
 }
 
 
@@ -61,6 +61,10 @@ using namespace OpenXLSX;
  */
 XLMergeCells::XLMergeCells() = default;
 
+namespace { // anonymous namespace: do not export any symbols from here
+    constexpr uint32_t mergeBucketRows = 64; // rows per bucket of the merge index
+} // anonymous namespace
+
 /**
  * @details Constructs a new XLMergeCells object. Invoked by XLWorksheet::mergeCells / ::unmergeCells
  * @note Unfortunately, there is no easy way to persist the reference cache, this could be optimized - however, references access shouldn't
@@ -79,11 +83,19 @@ XLMergeCells::XLMergeCells(const XMLNode& rootNode, std::vector< std::string_vie
     while (not mergeNode.empty()) {
         bool invalidNode = true;
 
-        // ===== For valid mergeCell nodes, add the reference to the reference cache
+        // ===== For valid mergeCell nodes, add the reference to the reference cache and its rectangle to the index
         if (std::string(mergeNode.name()) == "mergeCell") {
             std::string ref = mergeNode.attribute("ref").value();
             if (ref.length() > 0) {
+                // ===== A reference that can not be parsed is left in the document untouched, but can not be found by cell
+                XLMergeRect rect {};
+                try {
+                    rect = parseReference(ref);
+                }
+                catch (const XLInputError&) {}
+                m_rects.push_back(rect);
                 m_referenceCache.emplace_back(ref);
+                indexMerge(static_cast<XLMergeIndex>(m_rects.size() - 1));
                 invalidNode = false;
             }
         }
@@ -106,12 +118,8 @@ XLMergeCells::XLMergeCells(const XMLNode& rootNode, std::vector< std::string_vie
         mergeNode = nextNode;
     }
 
-    if (m_referenceCache.size() > 0) {
-        // ===== Ensure initial array count attribute / issue #351
-        XMLAttribute attr = m_mergeCellsNode->attribute("count");
-        if (attr.empty()) attr = m_mergeCellsNode->append_attribute("count");
-        attr.set_value(m_referenceCache.size());
-    }
+    if (m_referenceCache.size() > 0)
+        updateCount(); // ===== Ensure initial array count attribute / issue #351
     else // no merges left
         deleteAll(); // delete mergeCells element & re-initialize m_mergeCellsNode to a default-constructed XMLNode()
 }
@@ -130,6 +138,8 @@ XLMergeCells::XLMergeCells(const XLMergeCells& other)
     m_nodeOrder = other.m_nodeOrder;
     m_mergeCellsNode = other.m_mergeCellsNode ? std::make_unique<XMLNode>( *other.m_mergeCellsNode ) : std::unique_ptr<XMLNode> {};
     m_referenceCache = other.m_referenceCache;
+    m_rects = other.m_rects;
+    m_rowBuckets = other.m_rowBuckets;
 }
 
 /**
@@ -141,6 +151,8 @@ XLMergeCells::XLMergeCells(XLMergeCells&& other)
     m_nodeOrder = std::move( other.m_nodeOrder );
     m_mergeCellsNode = std::move( other.m_mergeCellsNode );
     m_referenceCache = std::move( other.m_referenceCache );
+    m_rects = std::move( other.m_rects );
+    m_rowBuckets = std::move( other.m_rowBuckets );
 }
 
 /**
@@ -152,6 +164,8 @@ XLMergeCells& XLMergeCells::operator=(const XLMergeCells& other)
     m_nodeOrder = other.m_nodeOrder;
     m_mergeCellsNode = other.m_mergeCellsNode ? std::make_unique<XMLNode>( *other.m_mergeCellsNode ) : std::unique_ptr<XMLNode> {};
     m_referenceCache = other.m_referenceCache;
+    m_rects = other.m_rects;
+    m_rowBuckets = other.m_rowBuckets;
     return *this;
 }
 
@@ -164,6 +178,8 @@ XLMergeCells& XLMergeCells::operator=(XLMergeCells&& other)
     m_nodeOrder = std::move( other.m_nodeOrder );
     m_mergeCellsNode = std::move( other.m_mergeCellsNode );
     m_referenceCache = std::move( other.m_referenceCache );
+    m_rects = std::move( other.m_rects );
+    m_rowBuckets = std::move( other.m_rowBuckets );
     return *this;
 }
 
@@ -172,50 +188,22 @@ XLMergeCells& XLMergeCells::operator=(XLMergeCells&& other)
  */
 bool XLMergeCells::valid() const { return ( m_rootNode != nullptr && not m_rootNode->empty() ); }
 
-
-namespace { // anonymous namespace: do not export any symbols from here
-    /**
-     * @brief Test if (range) reference overlaps with the cell window defined by topRow, firstCol, bottomRow, lastCol
-     * @return true in case of overlap, false if no overlap
-     */
-    bool XLReferenceOverlaps(std::string reference, uint32_t topRow, uint16_t firstCol, uint32_t bottomRow, uint16_t lastCol)
-    {
-        using namespace std::literals::string_literals;
-
-        size_t pos = reference.find_first_of(':'); // find split mark between top left and bottom right cell
-        if (pos < 2 || pos + 2 >= reference.length()) // range reference must have at least 2 characters before and after the colon
-            throw XLInputError("XLMergeCells::"s + __func__ + ": not a valid range reference: \""s + reference + "\""s);
-        XLCellReference refTL(reference.substr(0, pos));  // get top left cell reference
-        XLCellReference refBR(reference.substr(pos + 1)); // get bottom right cell reference
-
-        uint32_t refTopRow    = refTL.row();
-        uint16_t refFirstCol  = refTL.column();
-        uint32_t refBottomRow = refBR.row();
-        uint16_t refLastCol   = refBR.column();
-        if (refBottomRow < refTopRow || refLastCol < refFirstCol || (refBottomRow == refTopRow && refLastCol == refFirstCol))
-            throw XLInputError("XLMergeCells::"s + __func__ + ": not a valid range reference: \""s + reference + "\""s);
-
-// std::cout << __func__ << ":" << " reference is " << reference
-//    << " refTopRow is " << refTopRow << " refBottomRow is " << refBottomRow << " refFirstCol is " << refFirstCol << " refLastCol is " << refLastCol
-//    << " topRow is " << topRow << " bottomRow is " << bottomRow << " firstCol is " << firstCol << " lastCol is " << lastCol
-//    << std::endl;
-
-        // overlap
-        if (refTopRow <= bottomRow && refBottomRow >= topRow        // vertical overlap
-            && refFirstCol <= lastCol && refLastCol >= firstCol)    // horizontal overlap
-            return true;
-        return false; // otherwise: no overlap
-    }
-} // anonymous namespace
-
 /**
  * @details Look up a merge index by the reference. If the reference does not exist, the returned index is XLMergeNotFound (-1).
+ *          Merges do not overlap, so the only candidate is the merge that contains the top left cell of reference.
  */
 XLMergeIndex XLMergeCells::findMerge(const std::string& reference) const
 {
-    const auto iter = std::find_if(m_referenceCache.begin(), m_referenceCache.end(), [&](const std::string& ref) { return reference == ref; });
+    XLMergeRect rect {};
+    try {
+        rect = parseReference(reference);
+    }
+    catch (const XLInputError&) {
+        return XLMergeNotFound;
+    }
 
-    return iter == m_referenceCache.end() ? XLMergeNotFound : static_cast<XLMergeIndex>(std::distance(m_referenceCache.begin(), iter));
+    const XLMergeIndex index = findOverlap({ rect.topRow, rect.topRow, rect.firstCol, rect.firstCol });
+    return (index != XLMergeNotFound && m_referenceCache[index] == reference) ? index : XLMergeNotFound;
 }
 
 /**
@@ -229,12 +217,7 @@ bool XLMergeCells::mergeExists(const std::string& reference) const { return find
 XLMergeIndex XLMergeCells::findMergeByCell(const std::string& cellRef) const { return findMergeByCell(XLCellReference(cellRef)); }
 XLMergeIndex XLMergeCells::findMergeByCell(XLCellReference cellRef) const
 {
-    const auto iter = std::find_if(m_referenceCache.begin(), m_referenceCache.end(),
-    /**/                           [&](const std::string& ref) { // use XLReferenceOverlaps with a "range" that only contains cellRef
-    /**/                               return XLReferenceOverlaps( ref, cellRef.row(), cellRef.column(), cellRef.row(), cellRef.column());
-    /**/                           });
-
-    return iter == m_referenceCache.end() ? XLMergeNotFound : static_cast<XLMergeIndex>(std::distance(m_referenceCache.begin(), iter));
+    return findOverlap({ cellRef.row(), cellRef.row(), cellRef.column(), cellRef.column() });
 }
 
 /**
@@ -267,44 +250,61 @@ XLMergeIndex XLMergeCells::appendMerge(const std::string& reference)
     if (referenceCacheSize >= XLMaxMergeCells)
         throw XLInputError("XLMergeCells::"s + __func__ + ": exceeded max merge cells count "s + std::to_string(XLMaxMergeCells));
 
-    size_t pos = reference.find_first_of(':'); // find split mark between top left and bottom right cell
-    if (pos < 2 || pos + 2 >= reference.length()) // range reference must have at least 2 characters before and after the colon
+    const XLMergeRect rect = parseReference(reference);
+    if (rect.bottomRow == rect.topRow && rect.lastCol == rect.firstCol)
         throw XLInputError("XLMergeCells::"s + __func__ + ": not a valid range reference: \""s + reference + "\""s);
-    XLCellReference refTL(reference.substr(0, pos));  // get top left cell reference
-    XLCellReference refBR(reference.substr(pos + 1)); // get bottom right cell reference
 
-    uint32_t refTopRow    = refTL.row();
-    uint16_t refFirstCol  = refTL.column();
-    uint32_t refBottomRow = refBR.row();
-    uint16_t refLastCol   = refBR.column();
-    if (refBottomRow < refTopRow || refLastCol < refFirstCol || (refBottomRow == refTopRow && refLastCol == refFirstCol))
-        throw XLInputError("XLMergeCells::"s + __func__ + ": not a valid range reference: \""s + reference + "\""s);
-
-    for (std::string ref : m_referenceCache) {
-        if (XLReferenceOverlaps(ref, refTopRow, refFirstCol, refBottomRow, refLastCol))
-            throw XLInputError("XLMergeCells::"s + __func__ + ": reference \""s + reference
-            /**/                   + "\" overlaps with existing reference \""s + ref + "\""s);
-    }
+    const XLMergeIndex overlap = findOverlap(rect);
+    if (overlap != XLMergeNotFound)
+        throw XLInputError("XLMergeCells::"s + __func__ + ": reference \""s + reference
+        /**/                   + "\" overlaps with existing reference \""s + m_referenceCache[overlap] + "\""s);
     // if execution gets here: no overlaps
 
-    if (m_mergeCellsNode->empty()) // create mergeCells element if needed
-        m_mergeCellsNode = std::make_unique<XMLNode>(appendAndGetNode(*m_rootNode, "mergeCells", m_nodeOrder));
+    appendNode(reference);
+    m_rects.push_back(rect);
+    indexMerge(static_cast<XLMergeIndex>(referenceCacheSize));
+    updateCount();
 
-    // append new mergeCell element and set attribute ref
-    XMLNode insertAfter = m_mergeCellsNode->last_child_of_type(pugi::node_element);
-    XMLNode newMerge{};
-    if (insertAfter.empty()) newMerge = m_mergeCellsNode->prepend_child("mergeCell");
-    else                     newMerge = m_mergeCellsNode->insert_child_after("mergeCell", insertAfter);
-    if (newMerge.empty())
-        throw XLInternalError("XLMergeCells::"s + __func__ + ": failed to insert reference: \""s + reference + "\""s);
-    newMerge.append_attribute("ref").set_value(reference.c_str());
+    return static_cast<XLMergeIndex>(referenceCacheSize); // index of this element = previous referenceCacheSize
+}
+
+/**
+ * @details All references are checked and added to the index before the XML is modified. If a reference is invalid or
+ * overlaps, the references added to the index so far are removed from it again, so that nothing is appended.
+ */
+XLMergeIndex XLMergeCells::appendMerges(const std::vector<std::string>& references)
+{
+    using namespace std::literals::string_literals;
 
-    m_referenceCache.emplace_back(newMerge.attribute("ref").value()); // index of this element = previous referenceCacheSize
+    const size_t referenceCacheSize = m_referenceCache.size();
+    if (references.size() > XLMaxMergeCells - referenceCacheSize)
+        throw XLInputError("XLMergeCells::"s + __func__ + ": exceeded max merge cells count "s + std::to_string(XLMaxMergeCells));
 
-    // ===== Update the array count attribute
-    XMLAttribute attr = m_mergeCellsNode->attribute("count");
-    if (attr.empty()) attr = m_mergeCellsNode->append_attribute("count");
-    attr.set_value(m_referenceCache.size());
+    try {
+        for (const std::string& reference : references) {
+            const XLMergeRect rect = parseReference(reference);
+            if (rect.bottomRow == rect.topRow && rect.lastCol == rect.firstCol)
+                throw XLInputError("XLMergeCells::"s + __func__ + ": not a valid range reference: \""s + reference + "\""s);
+
+            const XLMergeIndex overlap = findOverlap(rect);
+            if (overlap != XLMergeNotFound) {
+                const std::string& other = static_cast<size_t>(overlap) < referenceCacheSize ? m_referenceCache[overlap]
+                                                                                             : references[overlap - referenceCacheSize];
+                throw XLInputError("XLMergeCells::"s + __func__ + ": reference \""s + reference
+                /**/                   + "\" overlaps with reference \""s + other + "\""s);
+            }
+            m_rects.push_back(rect);
+            indexMerge(static_cast<XLMergeIndex>(m_rects.size() - 1));
+        }
+    }
+    catch (...) {
+        for (size_t index = referenceCacheSize; index < m_rects.size(); ++index) unindexMerge(static_cast<XLMergeIndex>(index));
+        m_rects.resize(referenceCacheSize);
+        throw;
+    }
+
+    for (const std::string& reference : references) appendNode(reference);
+    if (not references.empty()) updateCount();
 
     return static_cast<XLMergeIndex>(referenceCacheSize);
 }
@@ -334,12 +334,16 @@ void XLMergeCells::deleteMerge(XLMergeIndex index)
 
     m_referenceCache.erase(m_referenceCache.begin() + curIndex);
 
-    if (m_referenceCache.size() > 0) {
-        // ===== Update the array count attribute
-        XMLAttribute attr = m_mergeCellsNode->attribute("count");
-        if (attr.empty()) attr = m_mergeCellsNode->append_attribute("count");
-        attr.set_value(m_referenceCache.size()); // update the array count attribute
+    // ===== Remove the merge from the index, and renumber the merges that followed it
+    unindexMerge(index);
+    m_rects.erase(m_rects.begin() + index);
+    for (auto& [bucketIndex, bucket] : m_rowBuckets) {
+        for (auto& entry : bucket.byFirstCol)
+            if (entry.second > index) --entry.second;
     }
+
+    if (m_referenceCache.size() > 0)
+        updateCount(); // update the array count attribute
     else // no merges left
         deleteAll(); // delete mergeCells element & re-initialize m_mergeCellsNode to a default-constructed XMLNode()
 }
@@ -347,6 +351,8 @@ void XLMergeCells::deleteMerge(XLMergeIndex index)
 void XLMergeCells::deleteAll()
 {
     m_referenceCache.clear();
+    m_rects.clear();
+    m_rowBuckets.clear();
     m_rootNode->remove_child(*m_mergeCellsNode);
     m_mergeCellsNode = std::make_unique<XMLNode>(XMLNode());
 }
@@ -355,3 +361,116 @@ void XLMergeCells::deleteAll()
  * @details Print the underlying XML using pugixml::xml_node::print
  */
 void XLMergeCells::print(std::basic_ostream<char>& ostr) const { m_mergeCellsNode->print(ostr); }
+
+/**
+ * @details A range reference must have at least 2 characters before and after the colon, and its bottom right cell must not
+ * be above or left of its top left cell. Single cell ranges are accepted here, as they may exist in a worksheet.
+ */
+XLMergeCells::XLMergeRect XLMergeCells::parseReference(const std::string& reference)
+{
+    using namespace std::literals::string_literals;
+
+    size_t pos = reference.find_first_of(':'); // find split mark between top left and bottom right cell
+    if (pos < 2 || pos == std::string::npos || pos + 2 >= reference.length())
+        throw XLInputError("XLMergeCells::"s + __func__ + ": not a valid range reference: \""s + reference + "\""s);
+    XLCellReference refTL(reference.substr(0, pos));  // get top left cell reference
+    XLCellReference refBR(reference.substr(pos + 1)); // get bottom right cell reference
+
+    const XLMergeRect rect { refTL.row(), refBR.row(), refTL.column(), refBR.column() };
+    if (rect.bottomRow < rect.topRow || rect.lastCol < rect.firstCol)
+        throw XLInputError("XLMergeCells::"s + __func__ + ": not a valid range reference: \""s + reference + "\""s);
+    return rect;
+}
+
+/**
+ * @details Only the buckets of the rows of rect are visited. Within a bucket, a merge can only overlap rect if its first
+ * column is at most rect.lastCol and at least rect.firstCol minus the widest merge of the bucket.
+ */
+XLMergeIndex XLMergeCells::findOverlap(const XLMergeRect& rect) const
+{
+    const uint32_t lastBucket = (rect.bottomRow - 1) / mergeBucketRows;
+    for (auto bucket = m_rowBuckets.lower_bound((rect.topRow - 1) / mergeBucketRows);
+         bucket != m_rowBuckets.end() && bucket->first <= lastBucket;
+         ++bucket)
+    {
+        const uint16_t minFirstCol = rect.firstCol > bucket->second.maxWidth ? rect.firstCol - bucket->second.maxWidth : 1;
+        for (auto entry = bucket->second.byFirstCol.lower_bound(minFirstCol);
+             entry != bucket->second.byFirstCol.end() && entry->first <= rect.lastCol;
+             ++entry)
+        {
+            const XLMergeRect& other = m_rects[entry->second];
+            if (other.topRow <= rect.bottomRow && other.bottomRow >= rect.topRow    // vertical overlap
+                && other.lastCol >= rect.firstCol)                                  // horizontal overlap (other.firstCol <= rect.lastCol by loop condition)
+                return entry->second;
+        }
+    }
+    return XLMergeNotFound;
+}
+
+/**
+ * @details
+ */
+void XLMergeCells::indexMerge(XLMergeIndex index)
+{
+    const XLMergeRect& rect  = m_rects[index];
+    if (rect.topRow == 0) return;    // unparseable reference
+    const uint16_t     width = rect.lastCol - rect.firstCol;
+    for (uint32_t bucketIndex = (rect.topRow - 1) / mergeBucketRows; bucketIndex <= (rect.bottomRow - 1) / mergeBucketRows; ++bucketIndex) {
+        XLMergeBucket& bucket = m_rowBuckets[bucketIndex];
+        bucket.byFirstCol.emplace(rect.firstCol, index);
+        bucket.maxWidth = std::max(bucket.maxWidth, width);
+    }
+}
+
+/**
+ * @details The widest merge of a bucket is not recomputed, which only costs some lookup time until the bucket is empty.
+ */
+void XLMergeCells::unindexMerge(XLMergeIndex index)
+{
+    const XLMergeRect& rect = m_rects[index];
+    if (rect.topRow == 0) return;    // unparseable reference, never indexed
+    for (uint32_t bucketIndex = (rect.topRow - 1) / mergeBucketRows; bucketIndex <= (rect.bottomRow - 1) / mergeBucketRows; ++bucketIndex) {
+        auto bucket = m_rowBuckets.find(bucketIndex);
+        if (bucket == m_rowBuckets.end()) continue;
+        auto [begin, end] = bucket->second.byFirstCol.equal_range(rect.firstCol);
+        for (auto entry = begin; entry != end; ++entry) {
+            if (entry->second == index) {
+                bucket->second.byFirstCol.erase(entry);
+                break;
+            }
+        }
+        if (bucket->second.byFirstCol.empty()) m_rowBuckets.erase(bucket);
+    }
+}
+
+/**
+ * @details
+ */
+void XLMergeCells::appendNode(const std::string& reference)
+{
+    using namespace std::literals::string_literals;
+
+    if (m_mergeCellsNode->empty()) // create mergeCells element if needed
+        m_mergeCellsNode = std::make_unique<XMLNode>(appendAndGetNode(*m_rootNode, "mergeCells", m_nodeOrder));
+
+    // append new mergeCell element and set attribute ref
+    XMLNode insertAfter = m_mergeCellsNode->last_child_of_type(pugi::node_element);
+    XMLNode newMerge{};
+    if (insertAfter.empty()) newMerge = m_mergeCellsNode->prepend_child("mergeCell");
+    else                     newMerge = m_mergeCellsNode->insert_child_after("mergeCell", insertAfter);
+    if (newMerge.empty())
+        throw XLInternalError("XLMergeCells::"s + __func__ + ": failed to insert reference: \""s + reference + "\""s);
+    newMerge.append_attribute("ref").set_value(reference.c_str());
+
+    m_referenceCache.emplace_back(newMerge.attribute("ref").value());
+}
+
+/**
+ * @details
+ */
+void XLMergeCells::updateCount()
+{
+    XMLAttribute attr = m_mergeCellsNode->attribute("count");
+    if (attr.empty()) attr = m_mergeCellsNode->append_attribute("count");
+    attr.set_value(m_referenceCache.size());
+}
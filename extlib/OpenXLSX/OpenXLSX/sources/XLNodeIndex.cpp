@@ -0,0 +1,162 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+
+
+// ===== External Includes ===== //
+#include <utility>
+
+// ===== OpenXLSX Includes ===== //
+#include "XLNodeIndex.hpp"
+
+using namespace OpenXLSX;
+
+/**
+ * @details
+ */
+XLNodeIndex::XLNodeIndex(std::string attributeName) : m_attributeName(std::move(attributeName)) {}
+
+/**
+ * @details
+ */
+const std::string& XLNodeIndex::attributeName() const { return m_attributeName; }
+
+/**
+ * @details The XML is the authoritative source: a hit is only returned if the node still carries the key, otherwise
+ * the attribute was changed behind the back of the index, and the index is rebuilt before the key is looked up again.
+ */
+XMLNode XLNodeIndex::findNode(XMLNode parentNode, const std::string& key)
+{
+    if (not m_valid || m_parentNode != parentNode)
+        rebuild(parentNode);
+    else if (parentNode.last_child_of_type(pugi::node_element) != m_lastNode)
+        absorbAppendedNodes();
+
+    auto pos = m_nodes.find(key);
+    if (pos == m_nodes.end()) return XMLNode {};
+    if (key == pos->second.attribute(m_attributeName.c_str()).value()) return pos->second;
+
+    rebuild(parentNode);
+    pos = m_nodes.find(key);
+    return pos != m_nodes.end() ? pos->second : XMLNode {};
+}
+
+/**
+ * @details
+ */
+void XLNodeIndex::insertNode(XMLNode node)
+{
+    if (not m_valid) return;
+
+    const XMLAttribute attribute = node.attribute(m_attributeName.c_str());
+    if (not attribute.empty()) m_nodes.emplace(attribute.value(), node);
+}
+
+/**
+ * @details
+ */
+void XLNodeIndex::eraseNode(XMLNode node)
+{
+    if (not m_valid) return;
+
+    auto pos = m_nodes.find(node.attribute(m_attributeName.c_str()).value());
+    if (pos != m_nodes.end() && pos->second == node) m_nodes.erase(pos);
+    if (node == m_lastNode) m_lastNode = node.previous_sibling_of_type(pugi::node_element);
+}
+
+/**
+ * @details
+ */
+void XLNodeIndex::invalidate()
+{
+    m_parentNode = XMLNode {};
+    m_lastNode   = XMLNode {};
+    m_nodes.clear();
+    m_valid = false;
+}
+
+/**
+ * @details Where several children carry the same attribute value, the first one in document order is indexed, which
+ * matches the result of XMLNode::find_child_by_attribute.
+ */
+void XLNodeIndex::rebuild(XMLNode parentNode)
+{
+    m_parentNode = parentNode;
+    m_lastNode   = XMLNode {};
+    m_nodes.clear();
+    for (XMLNode node = parentNode.first_child_of_type(pugi::node_element); not node.empty();
+         node         = node.next_sibling_of_type(pugi::node_element))
+    {
+        const XMLAttribute attribute = node.attribute(m_attributeName.c_str());
+        if (not attribute.empty()) m_nodes.emplace(attribute.value(), node);
+        m_lastNode = node;
+    }
+    m_valid = true;
+}
+
+/**
+ * @details Walks back from the last element child to m_lastNode, so the cost is proportional to the number of
+ * appended children.
+ */
+void XLNodeIndex::absorbAppendedNodes()
+{
+    const XMLNode last = m_parentNode.last_child_of_type(pugi::node_element);
+    XMLNode       node = last;
+    while (node != m_lastNode) {
+        if (node.empty()) {    // m_lastNode is no longer a child of m_parentNode: the index is beyond repair
+            rebuild(m_parentNode);
+            return;
+        }
+        node = node.previous_sibling_of_type(pugi::node_element);
+    }
+
+    node = (m_lastNode.empty() ? m_parentNode.first_child_of_type(pugi::node_element)
+                               : m_lastNode.next_sibling_of_type(pugi::node_element));
+    for (; not node.empty(); node = node.next_sibling_of_type(pugi::node_element)) {
+        const XMLAttribute attribute = node.attribute(m_attributeName.c_str());
+        if (not attribute.empty()) m_nodes.emplace(attribute.value(), node);
+    }
+    m_lastNode = last;
+}
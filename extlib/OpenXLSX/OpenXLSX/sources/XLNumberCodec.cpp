@@ -0,0 +1,217 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+// ===== External Includes ===== //
+#include <cerrno>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+// ===== OpenXLSX Includes ===== //
+#include "XLNumberCodec.hpp"
+
+using namespace OpenXLSX;
+
+namespace
+{
+    /**
+     * @brief Load eight characters into an integer, with the first character in the lowest byte regardless of the
+     * byte order of the platform (compilers reduce this to a single load on little endian platforms)
+     */
+    inline uint64_t loadEightChars(const char* text)
+    {
+        uint64_t chunk = 0;
+        for (int i = 0; i < 8; ++i) chunk |= static_cast<uint64_t>(static_cast<unsigned char>(text[i])) << (8 * i);
+        return chunk;
+    }
+
+    /**
+     * @brief Check that all eight characters of a chunk are the digits '0' to '9'
+     */
+    inline bool isEightDigits(uint64_t chunk)
+    {
+        return ((chunk & 0xF0F0F0F0F0F0F0F0) | (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+    }
+
+    /**
+     * @brief Convert a chunk of eight digits to its value, combining pairs of digits, then pairs of pairs and so on,
+     * with three multiplications instead of eight
+     */
+    inline uint32_t parseEightDigits(uint64_t chunk)
+    {
+        chunk = ((chunk & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+        chunk = ((chunk & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+        return static_cast<uint32_t>(((chunk & 0x0000FFFF0000FFFF) * 42949672960001) >> 32);
+    }
+}    // namespace
+
+/**
+ * @details
+ */
+char* OpenXLSX::formatInteger(int64_t value, char* first) { return std::to_chars(first, first + XLNumberBufferSize, value).ptr; }
+
+/**
+ * @details std::to_chars without a precision produces the shortest round-trip representation, which is both shorter
+ * and faster to produce than the 17 significant digits that pugixml and printf("%.17g") write. Standard libraries
+ * without floating point std::to_chars write 15 significant digits if these round-trip, and 17 otherwise.
+ */
+char* OpenXLSX::formatFloat(double value, char* first)
+{
+#ifdef FLOAT_CHARCONV_ENABLED
+    return std::to_chars(first, first + XLNumberBufferSize, value).ptr;
+#else
+    int length = std::snprintf(first, XLNumberBufferSize, "%.15g", value);
+    if (std::strtod(first, nullptr) != value) length = std::snprintf(first, XLNumberBufferSize, "%.17g", value);
+    return first + length;
+#endif
+}
+
+/**
+ * @details
+ */
+std::string OpenXLSX::formatFloat(double value)
+{
+    char buffer[XLNumberBufferSize];
+    return std::string(buffer, formatFloat(value, buffer));
+}
+
+/**
+ * @details Digits are converted eight at a time using SWAR (SIMD within a register) arithmetic on a 64 bit integer,
+ * which is portable and does not depend on a particular instruction set. At most 19 digits are accepted, as these
+ * always fit an uint64_t; longer texts (with leading zeros, or out of range) are left to std::from_chars.
+ */
+bool OpenXLSX::parseInteger(const char* first, const char* last, int64_t& value)
+{
+    const char* pos      = first;
+    const bool  negative = (pos != last && *pos == '-');
+    if (negative) ++pos;
+    if (pos == last) return false;
+    if (last - pos > 19) {
+        auto result = std::from_chars(first, last, value);
+        return result.ec == std::errc() && result.ptr == last;
+    }
+
+    uint64_t magnitude = 0;
+    for (; last - pos >= 8; pos += 8) {
+        const uint64_t chunk = loadEightChars(pos);
+        if (!isEightDigits(chunk)) return false;
+        magnitude = magnitude * 100000000 + parseEightDigits(chunk);
+    }
+    for (; pos != last; ++pos) {
+        const auto digit = static_cast<unsigned char>(*pos - '0');
+        if (digit > 9) return false;
+        magnitude = magnitude * 10 + digit;
+    }
+
+    constexpr auto maximum = static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+    if (negative) {
+        if (magnitude > maximum + 1) return false;
+        value = (magnitude == maximum + 1 ? std::numeric_limits<int64_t>::min() : -static_cast<int64_t>(magnitude));
+    }
+    else {
+        if (magnitude > maximum) return false;
+        value = static_cast<int64_t>(magnitude);
+    }
+    return true;
+}
+
+/**
+ * @details
+ */
+bool OpenXLSX::parseFloat(const char* first, const char* last, double& value)
+{
+#ifdef FLOAT_CHARCONV_ENABLED
+    auto result = std::from_chars(first, last, value);
+    return result.ec == std::errc() && result.ptr == last;
+#else
+    // ===== strtod needs a zero-terminated text, and also accepts whitespace, a plus sign and hexadecimal numbers, which
+    //       std::from_chars rejects
+    if (first == last || last - first >= 64 || *first == '+') return false;
+    char text[64];
+    for (size_t i = 0; first + i != last; ++i) {
+        if (std::strchr("0123456789.eE+-", first[i]) == nullptr || first[i] == 0) return false;
+        text[i] = first[i];
+    }
+    text[last - first] = 0;
+    char* end = nullptr;
+    errno     = 0;
+    const double result = std::strtod(text, &end);
+    if (end != text + (last - first) || errno == ERANGE) return false;
+    value = result;
+    return true;
+#endif
+}
+
+/**
+ * @details
+ */
+bool OpenXLSX::isFloatText(const char* first, const char* last)
+{
+    for (; first != last; ++first)
+        if (*first == '.' || *first == 'e' || *first == 'E') return true;
+    return false;
+}
+
+/**
+ * @details
+ */
+int64_t OpenXLSX::textToInteger(const char* text)
+{
+    int64_t value {};
+    if (parseInteger(text, text + std::strlen(text), value)) return value;
+    return static_cast<int64_t>(std::strtoll(text, nullptr, 10));
+}
+
+/**
+ * @details
+ */
+double OpenXLSX::textToFloat(const char* text)
+{
+    double value {};
+    if (parseFloat(text, text + std::strlen(text), value)) return value;
+    return std::strtod(text, nullptr);
+}
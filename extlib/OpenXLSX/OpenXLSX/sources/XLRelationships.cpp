@@ -341,11 +341,11 @@ XLRelationships::XLRelationships(XLXmlData* xmlData, std::string pathTo)
 XLRelationships::~XLRelationships() = default;
 
 /**
- * @details Returns the XLRelationshipItem with the given ID, by looking it up in the m_relationships map.
+ * @details Returns the XLRelationshipItem with the given ID, by looking it up in the index of the relationships by Id.
  */
 XLRelationshipItem XLRelationships::relationshipById(const std::string& id) const
 {
-    return XLRelationshipItem(xmlDocument().document_element().find_child_by_attribute("Id", id.c_str()));
+    return XLRelationshipItem(m_xmlData->getNodeIndex("Id")->findNode(xmlDocument().document_element(), id));
 }
 
 /**
@@ -395,7 +395,10 @@ std::vector<XLRelationshipItem> XLRelationships::relationships() const
 
 void XLRelationships::deleteRelationship(const std::string& relID)
 {
-    xmlDocument().document_element().remove_child(xmlDocument().document_element().find_child_by_attribute("Id", relID.c_str()));
+    XLNodeIndex*  idIndex      = m_xmlData->getNodeIndex("Id");
+    const XMLNode relationship = idIndex->findNode(xmlDocument().document_element(), relID);
+    idIndex->eraseNode(relationship);
+    xmlDocument().document_element().remove_child(relationship);
 }
 
 void XLRelationships::deleteRelationship(const XLRelationshipItem& item) { deleteRelationship(item.id()); }
@@ -459,7 +462,7 @@ bool XLRelationships::targetExists(const std::string& target) const
  */
 bool XLRelationships::idExists(const std::string& id) const
 {
-    return xmlDocument().document_element().find_child_by_attribute("Id", id.c_str()) != nullptr;
+    return not m_xmlData->getNodeIndex("Id")->findNode(xmlDocument().document_element(), id).empty();
 }
 
 /**
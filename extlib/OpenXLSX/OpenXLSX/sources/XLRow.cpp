@@ -245,7 +245,7 @@ namespace OpenXLSX
     {
         const auto node = m_rowNode->last_child_of_type(pugi::node_element);
         if (node.empty()) return 0;
-        return XLCellReference(node.attribute("r").value()).column();
+        return XLCellReference::columnFromAddress(node.attribute("r").value());
     }
 
     /**
@@ -271,7 +271,7 @@ namespace OpenXLSX
     {
         const XMLNode node = m_rowNode->last_child_of_type(pugi::node_element);
         if (node.empty()) return XLRowDataRange();    // empty range
-        return XLRowDataRange(*m_rowNode, 1, XLCellReference(node.attribute("r").value()).column(), m_sharedStrings.get());
+        return XLRowDataRange(*m_rowNode, 1, XLCellReference::columnFromAddress(node.attribute("r").value()), m_sharedStrings.get());
     }
 
     /**
@@ -299,17 +299,23 @@ namespace OpenXLSX
         if (m_rowNode->empty()) return XLCell{};
 
         XMLNode cellNode = m_rowNode->last_child_of_type(pugi::node_element);
+        auto    columnOf = [](XMLNode node) { return XLCellReference::columnFromAddress(node.attribute("r").value()); };
 
         // ===== If there are no cells in the current row, or the requested cell is beyond the last cell in the row...
-        if (cellNode.empty() || (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber))
+        const uint16_t lastColumn = (cellNode.empty() ? 0 : columnOf(cellNode));
+        if (cellNode.empty() || lastColumn < columnNumber)
             return XLCell{}; // fail
 
         // ===== If the requested node is closest to the end, start from the end and search backwards...
-        if (XLCellReference(cellNode.attribute("r").value()).column() - columnNumber < columnNumber) {
-            while (not cellNode.empty() && (XLCellReference(cellNode.attribute("r").value()).column() > columnNumber))
+        if (lastColumn - columnNumber < columnNumber) {
+            uint16_t column = lastColumn;
+            while (column > columnNumber) {
                 cellNode = cellNode.previous_sibling_of_type(pugi::node_element);
+                if (cellNode.empty()) return XLCell{}; // fail
+                column = columnOf(cellNode);
+            }
             // ===== If the backwards search failed to locate the requested cell
-            if (cellNode.empty() || (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber))
+            if (column < columnNumber)
                 return XLCell{}; // fail
         }
         // ===== Otherwise, start from the beginning
@@ -318,10 +324,13 @@ namespace OpenXLSX
             cellNode = m_rowNode->first_child_of_type(pugi::node_element);
 
             // ===== It has been verified above that the requested columnNumber is <= the column number of the last node_element, therefore this loop will halt:
-            while (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber)
+            uint16_t column = columnOf(cellNode);
+            while (column < columnNumber) {
                 cellNode = cellNode.next_sibling_of_type(pugi::node_element);
+                column   = columnOf(cellNode);
+            }
             // ===== If the forwards search failed to locate the requested cell
-            if (XLCellReference(cellNode.attribute("r").value()).column() > columnNumber)
+            if (column > columnNumber)
                 return XLCell{}; // fail
         }
         return XLCell(cellNode, m_sharedStrings.get());
@@ -390,6 +399,7 @@ namespace OpenXLSX
           m_lastRow(rowRange.m_lastRow),
           m_currentRow(),
           m_sharedStrings(rowRange.m_sharedStrings),
+          m_rowIndex(rowRange.m_rowIndex),
           m_endReached(false),
           m_hintRow(),
           m_hintRowNumber(0),
@@ -421,6 +431,7 @@ namespace OpenXLSX
           m_lastRow(other.m_lastRow),
           m_currentRow(other.m_currentRow),
           m_sharedStrings(other.m_sharedStrings),
+          m_rowIndex(other.m_rowIndex),
           m_endReached(other.m_endReached),
           m_hintRow(other.m_hintRow),
           m_hintRowNumber(other.m_hintRowNumber),
@@ -475,9 +486,9 @@ namespace OpenXLSX
 
         if (m_hintRow.empty()) {  // no hint has been established: fetch first row node the "tedious" way
             if (createIfMissing)     // getRowNode creates missing rows
-                m_currentRow = XLRow(getRowNode(*m_dataNode, m_currentRowNumber), m_sharedStrings.get());
+                m_currentRow = XLRow(getRowNode(*m_dataNode, m_currentRowNumber, m_rowIndex), m_sharedStrings.get());
             else                    // findRowNode returns an empty row for missing rows
-                m_currentRow = XLRow(findRowNode(*m_dataNode, m_currentRowNumber), m_sharedStrings.get());
+                m_currentRow = XLRow(findRowNode(*m_dataNode, m_currentRowNumber, m_rowIndex), m_sharedStrings.get());
         }
         else {
             // ===== Find or create, and fetch an XLRow at m_currentRowNumber
@@ -628,11 +639,16 @@ namespace OpenXLSX
      * @pre
      * @post
      */
-    XLRowRange::XLRowRange(const XMLNode& dataNode, uint32_t first, uint32_t last, const XLSharedStrings& sharedStrings)
+    XLRowRange::XLRowRange(const XMLNode&         dataNode,
+                           uint32_t               first,
+                           uint32_t               last,
+                           const XLSharedStrings& sharedStrings,
+                           XLRowIndex*            rowIndex)
         : m_dataNode(std::make_unique<XMLNode>(dataNode)),
           m_firstRow(first),
           m_lastRow(last),
-          m_sharedStrings(sharedStrings)
+          m_sharedStrings(sharedStrings),
+          m_rowIndex(rowIndex)
     {}
 
     /**
@@ -644,7 +660,8 @@ namespace OpenXLSX
         : m_dataNode(std::make_unique<XMLNode>(*other.m_dataNode)),
           m_firstRow(other.m_firstRow),
           m_lastRow(other.m_lastRow),
-          m_sharedStrings(other.m_sharedStrings)
+          m_sharedStrings(other.m_sharedStrings),
+          m_rowIndex(other.m_rowIndex)
     {}
 
     /**
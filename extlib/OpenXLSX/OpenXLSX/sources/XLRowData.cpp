@@ -136,7 +136,7 @@ namespace OpenXLSX
         // ====== is higher than the computed column number, then insert the node.
         // BUG BUGFIX 2024-04-26: check was for m_cellNode->empty(), allowing an invalid test for the attribute r, discovered
         //       because the modified XLCellReference throws an exception on invalid parameter
-        else if (cellNode.empty() || XLCellReference(cellNode.attribute("r").value()).column() > cellNumber) {
+        else if (cellNode.empty() || XLCellReference::columnFromAddress(cellNode.attribute("r").value()) > cellNumber) {
             cellNode = m_dataRange->m_rowNode->insert_child_after("c", *m_currentCell.m_cellNode);
             setDefaultCellAttributes(cellNode, XLCellReference(
             /**/                                   static_cast<uint32_t>(m_dataRange->m_rowNode->attribute("r").as_ullong()), cellNumber
@@ -147,7 +147,7 @@ namespace OpenXLSX
 
         // ===== Otherwise, the cell node and the column number match.
         else {
-            assert(XLCellReference(cellNode.attribute("r").value()).column() == cellNumber);
+            assert(XLCellReference::columnFromAddress(cellNode.attribute("r").value()) == cellNumber);
             m_currentCell = XLCell(cellNode, m_dataRange->m_sharedStrings.get());
         }
 
@@ -449,7 +449,7 @@ namespace OpenXLSX
     {
         // ===== Determine the number of cells in the current row. Create a std::vector of the same size.
         const XMLNode  lastElementChild = m_rowNode->last_child_of_type(pugi::node_element);
-        const uint16_t numCells = (lastElementChild.empty() ? 0 : XLCellReference(lastElementChild.attribute("r").value()).column());
+        const uint16_t numCells = (lastElementChild.empty() ? 0 : XLCellReference::columnFromAddress(lastElementChild.attribute("r").value()));
         std::vector<XLCellValue> result(static_cast<uint64_t>(numCells));
 
         // ===== If there are one or more cells in the current row, iterate through them and add the value to the container.
@@ -457,7 +457,7 @@ namespace OpenXLSX
             XMLNode node = lastElementChild;    // avoid unneeded call to first_child_of_type by iterating backwards, vector is random
                                                 // access so it doesn't matter
             while (not node.empty()) {
-                result[XLCellReference(node.attribute("r").value()).column() - 1] = XLCell(node, m_row->m_sharedStrings.get()).value();
+                result[XLCellReference::columnFromAddress(node.attribute("r").value()) - 1] = XLCell(node, m_row->m_sharedStrings.get()).value();
                 node                                                              = node.previous_sibling_of_type(pugi::node_element);
             }
         }
@@ -486,7 +486,7 @@ namespace OpenXLSX
         std::vector<XMLNode> toBeDeleted;
         XMLNode              cellNode = m_rowNode->first_child_of_type(pugi::node_element);
         while (not cellNode.empty()) {
-            if (XLCellReference(cellNode.attribute("r").value()).column() <= count) {
+            if (XLCellReference::columnFromAddress(cellNode.attribute("r").value()) <= count) {
                 toBeDeleted.emplace_back(cellNode);
                 XMLNode nextNode = cellNode.next_sibling();    // get next "regular" sibling (any type) before advancing cellNode
                 cellNode         = cellNode.next_sibling_of_type(pugi::node_element);
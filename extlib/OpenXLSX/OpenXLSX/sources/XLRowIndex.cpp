@@ -0,0 +1,188 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+
+// ===== External Includes ===== //
+#include <algorithm>
+#include <string>
+
+// ===== OpenXLSX Includes ===== //
+#include "XLConstants.hpp"
+#include "XLException.hpp"
+#include "XLRowIndex.hpp"
+
+using namespace OpenXLSX;
+
+namespace
+{
+    /**
+     * @brief Throw XLCellAddressError if rowNumber is not a valid row number
+     */
+    void checkRowNumber(uint32_t rowNumber)
+    {
+        if (rowNumber < 1 || rowNumber > OpenXLSX::MAX_ROWS) {
+            using namespace std::literals::string_literals;
+            throw XLCellAddressError("rowNumber "s + std::to_string(rowNumber) + " is outside valid range [1;"s + std::to_string(OpenXLSX::MAX_ROWS) + "]"s);
+        }
+    }
+
+    /**
+     * @brief Comparison of an index entry with a row number, for use with std::lower_bound
+     */
+    bool entryBefore(const std::pair<uint32_t, XMLNode>& entry, uint32_t rowNumber) { return entry.first < rowNumber; }
+}    // namespace
+
+/**
+ * @details
+ */
+XMLNode XLRowIndex::findRowNode(XMLNode sheetDataNode, uint32_t rowNumber)
+{
+    checkRowNumber(rowNumber);
+
+    auto pos = locate(sheetDataNode, rowNumber);
+    if (pos != m_rows.end() && pos->first == rowNumber) return pos->second;
+    return XMLNode {};
+}
+
+/**
+ * @details
+ */
+XMLNode XLRowIndex::findRowNodeAtOrAfter(XMLNode sheetDataNode, uint32_t rowNumber)
+{
+    checkRowNumber(rowNumber);
+
+    auto pos = locate(sheetDataNode, rowNumber);
+    return pos != m_rows.end() ? pos->second : XMLNode {};
+}
+
+/**
+ * @details A missing row is inserted directly after its indexed predecessor, which makes appending rows at the end of
+ * the sheet as cheap as a lookup.
+ */
+XMLNode XLRowIndex::getRowNode(XMLNode sheetDataNode, uint32_t rowNumber)
+{
+    checkRowNumber(rowNumber);
+
+    auto pos = locate(sheetDataNode, rowNumber);
+    if (pos != m_rows.end() && pos->first == rowNumber) return pos->second;
+
+    XMLNode result;
+    if (pos == m_rows.end())
+        result = sheetDataNode.append_child("row");
+    else if (pos == m_rows.begin())
+        result = sheetDataNode.prepend_child("row");    // keeps whitespace formatting towards next row node when saving
+    else
+        result = sheetDataNode.insert_child_after("row", std::prev(pos)->second);
+    result.append_attribute("r") = rowNumber;
+
+    m_rows.insert(pos, XLRowEntry(rowNumber, result));
+    return result;
+}
+
+/**
+ * @details
+ */
+void XLRowIndex::eraseRow(uint32_t rowNumber)
+{
+    if (not m_valid) return;
+
+    auto pos = std::lower_bound(m_rows.begin(), m_rows.end(), rowNumber, entryBefore);
+    if (pos != m_rows.end() && pos->first == rowNumber) m_rows.erase(pos);
+}
+
+/**
+ * @details
+ */
+void XLRowIndex::invalidate()
+{
+    m_sheetDataNode = XMLNode {};
+    m_rows.clear();
+    m_valid = false;
+}
+
+/**
+ * @details The XML is the authoritative source, so before a position is returned, it is verified that the row node
+ * following the indexed predecessor is the indexed successor. If it is not, rows have been inserted behind the back of
+ * the index, and the row nodes found in between are absorbed into the index. As rows are stored in ascending order in
+ * sheetData, they all belong at that position.
+ */
+std::vector<XLRowIndex::XLRowEntry>::iterator XLRowIndex::locate(XMLNode sheetDataNode, uint32_t rowNumber)
+{
+    if (not m_valid || m_sheetDataNode != sheetDataNode) rebuild(sheetDataNode);
+
+    auto pos = std::lower_bound(m_rows.begin(), m_rows.end(), rowNumber, entryBefore);
+    if (pos != m_rows.end() && pos->first == rowNumber) return pos;
+
+    // ===== Verify that there is no unindexed row node between the predecessor and pos
+    XMLNode next     = (pos == m_rows.begin() ? sheetDataNode.first_child_of_type(pugi::node_element)
+                                              : std::prev(pos)->second.next_sibling_of_type(pugi::node_element));
+    XMLNode expected = (pos == m_rows.end() ? XMLNode {} : pos->second);
+    if (next == expected) return pos;
+
+    std::vector<XLRowEntry> unindexed;
+    for (XMLNode node = next; node != expected; node = node.next_sibling_of_type(pugi::node_element)) {
+        if (node.empty()) {    // expected node was not found behind the predecessor: the index is beyond repair
+            rebuild(sheetDataNode);
+            return std::lower_bound(m_rows.begin(), m_rows.end(), rowNumber, entryBefore);
+        }
+        unindexed.emplace_back(static_cast<uint32_t>(node.attribute("r").as_ullong()), node);
+    }
+    pos = m_rows.insert(pos, unindexed.begin(), unindexed.end());
+
+    return std::lower_bound(pos, pos + static_cast<std::ptrdiff_t>(unindexed.size()), rowNumber, entryBefore);
+}
+
+/**
+ * @details
+ */
+void XLRowIndex::rebuild(XMLNode sheetDataNode)
+{
+    m_sheetDataNode = sheetDataNode;
+    m_rows.clear();
+    for (XMLNode node = sheetDataNode.first_child_of_type(pugi::node_element); not node.empty();
+         node = node.next_sibling_of_type(pugi::node_element))
+        m_rows.emplace_back(static_cast<uint32_t>(node.attribute("r").as_ullong()), node);
+    m_valid = true;
+}
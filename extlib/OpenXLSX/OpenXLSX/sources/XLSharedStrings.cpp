@@ -63,9 +63,10 @@ using namespace OpenXLSX;
  * @details Constructs a new XLSharedStrings object. Only one (common) object is allowed per XLDocument instance.
  * A filepath to the underlying XML file must be provided.
  */
-XLSharedStrings::XLSharedStrings(XLXmlData* xmlData, std::deque<std::string>* stringCache)
+XLSharedStrings::XLSharedStrings(XLXmlData* xmlData, std::deque<std::string>* stringCache, XLSharedStringIndex* stringIndex)
     : XLXmlFile(xmlData),
-      m_stringCache(stringCache)
+      m_stringCache(stringCache),
+      m_stringIndex(stringIndex)
 {
     XMLDocument & doc = xmlDocument();
     if (doc.document_element().empty())    // handle a bad (no document element) xl/sharedStrings.xml
@@ -89,12 +90,13 @@ XLSharedStrings::~XLSharedStrings() = default;
 
 /**
  * @details Look up a string index by the string content. If the string does not exist, the returned index is -1.
+ * @note uses the hash index m_stringIndex instead of a linear scan over m_stringCache
  */
 int32_t XLSharedStrings::getStringIndex(const std::string& str) const
 {
-    const auto iter = std::find_if(m_stringCache->begin(), m_stringCache->end(), [&](const std::string& s) { return str == s; });
+    const auto iter = m_stringIndex->find(std::string_view(str));
 
-    return iter == m_stringCache->end() ? -1 : static_cast<int32_t>(std::distance(m_stringCache->begin(), iter));
+    return iter == m_stringIndex->end() ? -1 : iter->second;
 }
 
 /**
@@ -131,6 +133,7 @@ int32_t XLSharedStrings::appendString(const std::string& str) const
         textNode.append_attribute("xml:space").set_value("preserve");    // pull request #161
     textNode.text().set(str.c_str());
     m_stringCache->emplace_back(textNode.text().get());    // index of this element = previous stringCacheSize
+    m_stringIndex->emplace(m_stringCache->back(), static_cast<int32_t>(stringCacheSize));    // no-op if the string is already indexed
 
     return static_cast<int32_t>(stringCacheSize);
 }
@@ -152,7 +155,21 @@ void XLSharedStrings::clearString(int32_t index) const   // 2024-04-30: whitespa
         throw XLInternalError("XLSharedStrings::"s + __func__ + ": index "s + std::to_string(index) + " is out of range"s);
     }
 
-    (*m_stringCache)[index] = "";
+    // ===== The index key is a view into the cache entry: drop it before the entry is modified, and re-point it to the
+    //        next duplicate of the same string (if any) so that lookups keep returning the lowest matching index.
+    std::string& cachedString = (*m_stringCache)[index];
+    if (const auto iter = m_stringIndex->find(cachedString); iter != m_stringIndex->end() && iter->second == index) {
+        m_stringIndex->erase(iter);
+        for (size_t i = static_cast<size_t>(index) + 1; i < m_stringCache->size(); ++i) {
+            if ((*m_stringCache)[i] == cachedString) {
+                m_stringIndex->emplace((*m_stringCache)[i], static_cast<int32_t>(i));
+                break;
+            }
+        }
+    }
+    cachedString = "";
+    if (const auto iter = m_stringIndex->find(cachedString); iter == m_stringIndex->end() || iter->second > index)
+        (*m_stringIndex)[cachedString] = index;
     // auto iter            = xmlDocument().document_element().children().begin();
     // std::advance(iter, index);
     // iter->text().set(""); // 2024-04-30: BUGFIX: this was never going to work, <si> entries can be plenty that need to be cleared,
@@ -191,3 +208,14 @@ int32_t XLSharedStrings::rewriteXmlFromCache()
     }
     return writtenStrings;
 }
+
+/**
+ * @details Index each distinct string by its first occurrence, matching the result of a front-to-back search
+ */
+void XLSharedStrings::rebuildIndex()
+{
+    m_stringIndex->clear();
+    m_stringIndex->reserve(m_stringCache->size());
+    int32_t index = 0;
+    for (const std::string& s : *m_stringCache) m_stringIndex->emplace(s, index++);
+}
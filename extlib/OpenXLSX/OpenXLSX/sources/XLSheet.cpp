@@ -48,6 +48,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #include <cctype>    // std::isdigit (issue #330)
 #include <limits>    // std::numeric_limits
 #include <map>       // std::multimap
+#include <string_view>
 #include <pugixml.hpp>
 
 // ===== OpenXLSX Includes ===== //
@@ -939,6 +940,49 @@ std::string XLConditionalFormats::summary() const
 
 // ========== XLWorksheet Member Functions
 
+namespace
+{
+    /**
+     * @brief extend dimension so that it includes the first and the last cell of rowNode, if the row has any cells
+     */
+    void includeRowInSheetDimension(XLSheetDimension& dimension, XMLNode rowNode)
+    {
+        const XMLNode firstCell = rowNode.first_child_of_type(pugi::node_element);
+        if (firstCell.empty()) return;
+
+        const auto     row         = static_cast<uint32_t>(rowNode.attribute("r").as_ullong());
+        const uint16_t firstColumn = XLCellReference::columnFromAddress(firstCell.attribute("r").value());
+        const uint16_t lastColumn  = XLCellReference::columnFromAddress(rowNode.last_child_of_type(pugi::node_element).attribute("r").value());
+        if (firstColumn != 0) dimension.include(row, firstColumn);
+        if (lastColumn != 0) dimension.include(row, lastColumn);
+    }
+
+    /**
+     * @brief determine the bounding box of all cells in sheetDataNode by scanning all rows
+     */
+    XLSheetDimension scanSheetDimension(XMLNode sheetDataNode)
+    {
+        XLSheetDimension dimension;
+        for (XMLNode rowNode = sheetDataNode.first_child_of_type(pugi::node_element); not rowNode.empty();
+             rowNode         = rowNode.next_sibling_of_type(pugi::node_element))
+            includeRowInSheetDimension(dimension, rowNode);
+        return dimension;
+    }
+
+    /**
+     * @brief store dimension in the ref attribute of dimensionNode, unless it is already stored there
+     */
+    void writeSheetDimension(XMLNode dimensionNode, const XLSheetDimension& dimension)
+    {
+        char         buffer[24];
+        const size_t length = formatSheetDimension(dimension, buffer);
+        XMLAttribute ref    = dimensionNode.attribute("ref");
+        if (ref.empty()) ref = dimensionNode.append_attribute("ref");
+        if (std::string_view(ref.value()) != std::string_view(buffer, length)) ref.set_value(buffer, length);
+    }
+}    // namespace
+
+
 /**
  * @details The constructor does some slight reconfiguration of the XML file, in order to make parsing easier.
  * For example, columns with identical formatting are by default grouped under the same node. However, this makes it more difficult to
@@ -946,12 +990,27 @@ std::string XLConditionalFormats::summary() const
  */
 XLWorksheet::XLWorksheet(XLXmlData* xmlData) : XLSheetBase(xmlData)
 {
-    // ===== Read the dimensions of the Sheet and set data members accordingly.
-    if (const std::string dimensions = xmlDocument().document_element().child("dimension").attribute("ref").value();
-        dimensions.find(':') == std::string::npos)
-        xmlDocument().document_element().child("dimension").set_value("A1");
+    // ===== Make sure that <dimension> holds the bounding box of all cells, as it is maintained from here on when cells are created
+    //       (see setDefaultCellAttributes) and rows are deleted. The stored range is trusted if it agrees with the first and the last
+    //       row that have cells, otherwise the rows are scanned once.
+    XMLNode          docElement    = xmlDocument().document_element();
+    const XMLNode    sheetDataNode = docElement.child("sheetData");
+    const XMLNode    dimensionNode = appendAndGetNode(docElement, "dimension", m_nodeOrder);
+    XLSheetDimension edges;
+    XMLNode          firstRow = sheetDataNode.first_child_of_type(pugi::node_element);
+    while (not firstRow.empty() && firstRow.first_child_of_type(pugi::node_element).empty()) firstRow = firstRow.next_sibling_of_type(pugi::node_element);
+    if (not firstRow.empty()) {
+        XMLNode lastRow = sheetDataNode.last_child_of_type(pugi::node_element);
+        while (lastRow.first_child_of_type(pugi::node_element).empty()) lastRow = lastRow.previous_sibling_of_type(pugi::node_element);
+        includeRowInSheetDimension(edges, firstRow);
+        includeRowInSheetDimension(edges, lastRow);
+    }
+    const XLSheetDimension stored = parseSheetDimension(dimensionNode.attribute("ref").value());
+    if (edges.empty() || (stored.firstRow == edges.firstRow && stored.lastRow == edges.lastRow && stored.firstColumn <= edges.firstColumn &&
+                          stored.lastColumn >= edges.lastColumn))
+        writeSheetDimension(dimensionNode, edges.empty() ? edges : stored);
     else
-        xmlDocument().document_element().child("dimension").set_value(dimensions.substr(dimensions.find(':') + 1).c_str());
+        writeSheetDimension(dimensionNode, scanSheetDimension(sheetDataNode));
 
     // If Column properties are grouped, divide them into properties for individual Columns.
     if (xmlDocument().document_element().child("cols").type() != pugi::node_null) {
@@ -1092,7 +1151,7 @@ XLCellAssignable XLWorksheet::cell(const XLCellReference& ref) const { return ce
  */
 XLCellAssignable XLWorksheet::cell(uint32_t rowNumber, uint16_t columnNumber) const
 {
-    const XMLNode rowNode  = getRowNode(xmlDocument().document_element().child("sheetData"), rowNumber);
+    const XMLNode rowNode  = getRowNode(xmlDocument().document_element().child("sheetData"), rowNumber, m_xmlData->getRowIndex());
     const XMLNode cellNode = getCellNode(rowNode, columnNumber, rowNumber);
     // ===== Move-construct XLCellAssignable from temporary XLCell
     return XLCellAssignable(XLCell(cellNode, parentDoc().sharedStrings()));
@@ -1113,7 +1172,7 @@ XLCellAssignable XLWorksheet::findCell(const XLCellReference& ref) const { retur
  */
 XLCellAssignable XLWorksheet::findCell(uint32_t rowNumber, uint16_t columnNumber) const
 {
-    return XLCellAssignable(XLCell(findCellNode(findRowNode( xmlDocument().document_element().child("sheetData"), rowNumber ), columnNumber), parentDoc().sharedStrings()));
+    return XLCellAssignable(XLCell(findCellNode(findRowNode( xmlDocument().document_element().child("sheetData"), rowNumber, m_xmlData->getRowIndex() ), columnNumber), parentDoc().sharedStrings()));
 }
 
 /**
@@ -1132,6 +1191,22 @@ XLCellRange XLWorksheet::range(const XLCellReference& topLeft, const XLCellRefer
                        parentDoc().sharedStrings());
 }
 
+/**
+ * @details
+ */
+XLColumnarRange XLWorksheet::columnarRange(const XLCellReference& topLeft, const XLCellReference& bottomRight) const
+{
+    if (bottomRight.row() < topLeft.row() || bottomRight.column() < topLeft.column())
+        throw XLInputError("XLWorksheet::columnarRange: bottomRight (" + bottomRight.address() + ") is above or left of topLeft (" + topLeft.address() + ")");
+    return XLColumnarRange(xmlDocument().document_element().child("sheetData"),
+                           m_xmlData->getRowIndex(),
+                           parentDoc().sharedStrings(),
+                           topLeft.row(),
+                           topLeft.column(),
+                           bottomRight.row(),
+                           bottomRight.column());
+}
+
 /**
  * @details Get a range based on two cell reference strings
  */
@@ -1162,7 +1237,8 @@ XLRowRange XLWorksheet::rows() const    // 2024-04-29: patched for whitespace
                       (sheetDataNode.last_child_of_type(pugi::node_element).empty()
                            ? 1
                            : static_cast<uint32_t>(sheetDataNode.last_child_of_type(pugi::node_element).attribute("r").as_ullong())),
-                      parentDoc().sharedStrings());
+                      parentDoc().sharedStrings(),
+                      m_xmlData->getRowIndex());
 }
 
 /**
@@ -1175,7 +1251,8 @@ XLRowRange XLWorksheet::rows(uint32_t rowCount) const
     return XLRowRange(xmlDocument().document_element().child("sheetData"),
                       1,
                       rowCount,
-                      parentDoc().sharedStrings());
+                      parentDoc().sharedStrings(),
+                      m_xmlData->getRowIndex());
 }
 
 /**
@@ -1188,7 +1265,8 @@ XLRowRange XLWorksheet::rows(uint32_t firstRow, uint32_t lastRow) const
     return XLRowRange(xmlDocument().document_element().child("sheetData"),
                       firstRow,
                       lastRow,
-                      parentDoc().sharedStrings());
+                      parentDoc().sharedStrings(),
+                      m_xmlData->getRowIndex());
 }
 
 /**
@@ -1198,7 +1276,7 @@ XLRowRange XLWorksheet::rows(uint32_t firstRow, uint32_t lastRow) const
  */
 XLRow XLWorksheet::row(uint32_t rowNumber) const
 {
-    return XLRow { getRowNode(xmlDocument().document_element().child("sheetData"), rowNumber),
+    return XLRow { getRowNode(xmlDocument().document_element().child("sheetData"), rowNumber, m_xmlData->getRowIndex()),
                    parentDoc().sharedStrings() };
 }
 
@@ -1302,19 +1380,12 @@ XLColumn XLWorksheet::column(std::string const& columnRef) const { return column
 XLCellReference XLWorksheet::lastCell() const noexcept { return { rowCount(), columnCount() }; }
 
 /**
- * @details Iterates through the rows and finds the maximum number of cells.
+ * @details Returns the last column of the used range, which is kept in the <dimension> element, so that the rows do not have to be
+ * scanned.
  */
 uint16_t XLWorksheet::columnCount() const noexcept
 {
-    uint16_t maxCount = 0;    // Pull request: Update XLSheet.cpp with correct type #176, Explicitely cast to unsigned short int #163
-    XLRowRange rowsRange = rows();
-    for (XLRowIterator rowIt = rowsRange.begin(); rowIt != rowsRange.end(); ++rowIt ) {
-        if (rowIt.rowExists()) {
-            uint16_t cellCount = rowIt->cellCount();
-            maxCount = std::max(cellCount, maxCount);
-        }
-    }
-    return maxCount;
+    return readSheetDimension(xmlDocument().document_element()).lastColumn;
 }
 
 /**
@@ -1326,6 +1397,16 @@ uint32_t XLWorksheet::rowCount() const noexcept
         xmlDocument().document_element().child("sheetData").last_child_of_type(pugi::node_element).attribute("r").as_ullong());
 }
 
+/**
+ * @details The used range is kept in the <dimension> element, see the XLWorksheet constructor.
+ */
+XLCellRange XLWorksheet::usedRange() const
+{
+    const XLSheetDimension dimension = readSheetDimension(xmlDocument().document_element());
+    if (dimension.empty()) return range(XLCellReference("A1"), XLCellReference("A1"));
+    return range(XLCellReference(dimension.firstRow, dimension.firstColumn), XLCellReference(dimension.lastRow, dimension.lastColumn));
+}
+
 /**
  * @details finds a given row and deletes it
  */
@@ -1349,8 +1430,21 @@ bool XLWorksheet::deleteRow(uint32_t rowNumber)
 
     if (row.attribute("r").as_ullong() != rowNumber) return false;    // row not found in XML
 
-    // ===== If row was located: remove it
-    return xmlDocument().document_element().child("sheetData").remove_child(row);
+    // ===== If row was located: remove it, after making sure that the row index does not keep the node
+    m_xmlData->getRowIndex()->eraseRow(rowNumber);
+    XLSheetDimension deleted;
+    includeRowInSheetDimension(deleted, row);
+    if (not xmlDocument().document_element().child("sheetData").remove_child(row)) return false;
+
+    // ===== If the row had cells on the edge of the used range, the used range may have shrunk: determine it anew
+    const XMLNode dimensionNode = xmlDocument().document_element().child("dimension");
+    if (not deleted.empty() && not dimensionNode.empty()) {
+        const XLSheetDimension dimension = readSheetDimension(xmlDocument().document_element());
+        if (deleted.firstRow == dimension.firstRow || deleted.lastRow == dimension.lastRow || deleted.firstColumn == dimension.firstColumn ||
+            deleted.lastColumn == dimension.lastColumn)
+            writeSheetDimension(dimensionNode, scanSheetDimension(xmlDocument().document_element().child("sheetData")));
+    }
+    return true;
 }
 
 /**
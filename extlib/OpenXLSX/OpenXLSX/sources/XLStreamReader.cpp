@@ -0,0 +1,481 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+
+// ===== External Includes ===== //
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// ===== OpenXLSX Includes ===== //
+#include "XLCellReference.hpp"
+#include "XLConstants.hpp"
+#include "XLException.hpp"
+#include "XLNumberCodec.hpp"
+#include "XLStreamReader.hpp"
+
+using namespace OpenXLSX;
+
+namespace
+{
+    constexpr size_t streamChunkSize = 64 * 1024;    // Bytes decompressed per read from the source
+
+    /**
+     * @brief Strip the namespace prefix from an element or attribute name
+     */
+    std::string_view localName(std::string_view name)
+    {
+        const size_t colon = name.find(':');
+        return colon == std::string_view::npos ? name : name.substr(colon + 1);
+    }
+
+    /**
+     * @brief Find the raw value of the attribute with the given local name in the attribute list of a tag
+     * @return true if the attribute is present
+     */
+    bool findAttribute(std::string_view attributes, std::string_view name, std::string_view& value)
+    {
+        size_t pos = 0;
+        while (pos < attributes.size()) {
+            while (pos < attributes.size() && std::isspace(static_cast<unsigned char>(attributes[pos]))) ++pos;
+            const size_t nameBegin = pos;
+            while (pos < attributes.size() && attributes[pos] != '=' && !std::isspace(static_cast<unsigned char>(attributes[pos]))) ++pos;
+            const std::string_view attributeName = attributes.substr(nameBegin, pos - nameBegin);
+            while (pos < attributes.size() && attributes[pos] != '"' && attributes[pos] != '\'') ++pos;
+            if (pos == attributes.size()) return false;
+            const char   quote      = attributes[pos++];
+            const size_t valueBegin = pos;
+            while (pos < attributes.size() && attributes[pos] != quote) ++pos;
+            if (localName(attributeName) == name) {
+                value = attributes.substr(valueBegin, pos - valueBegin);
+                return true;
+            }
+            ++pos;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Append a code point to str as UTF-8
+     */
+    void appendUtf8(std::string& str, uint32_t codePoint)
+    {
+        if (codePoint < 0x80)
+            str += static_cast<char>(codePoint);
+        else if (codePoint < 0x800) {
+            str += static_cast<char>(0xC0 | (codePoint >> 6));
+            str += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+        else if (codePoint < 0x10000) {
+            str += static_cast<char>(0xE0 | (codePoint >> 12));
+            str += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            str += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+        else {
+            str += static_cast<char>(0xF0 | (codePoint >> 18));
+            str += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            str += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            str += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+    }
+
+    /**
+     * @brief Append character data to str, replacing entity and character references and normalizing line ends the
+     * way pugixml does with the default parse options
+     */
+    void appendDecoded(std::string& str, std::string_view data)
+    {
+        for (size_t pos = 0; pos < data.size(); ++pos) {
+            const char ch = data[pos];
+            if (ch == '\r') {
+                str += '\n';
+                if (pos + 1 < data.size() && data[pos + 1] == '\n') ++pos;
+                continue;
+            }
+            if (ch != '&') {
+                str += ch;
+                continue;
+            }
+
+            const size_t end = data.find(';', pos);
+            if (end == std::string_view::npos) {
+                str += ch;
+                continue;
+            }
+            const std::string_view entity = data.substr(pos + 1, end - pos - 1);
+            if (entity == "lt") str += '<';
+            else if (entity == "gt") str += '>';
+            else if (entity == "amp") str += '&';
+            else if (entity == "quot") str += '"';
+            else if (entity == "apos") str += '\'';
+            else if (entity.size() > 1 && entity[0] == '#') {
+                const bool hex = entity[1] == 'x';
+                appendUtf8(str, static_cast<uint32_t>(std::strtoul(std::string(entity.substr(hex ? 2 : 1)).c_str(), nullptr, hex ? 16 : 10)));
+            }
+            else {
+                str += ch;
+                continue;
+            }
+            pos = end;
+        }
+    }
+}    // namespace
+
+/**
+ * @details
+ */
+XLStreamReader::XLStreamReader(XLZipEntryStream source, const XLSharedStrings& sharedStrings)
+    : m_source(std::move(source)),
+      m_sharedStrings(sharedStrings)
+{}
+
+/**
+ * @details
+ */
+XLStreamReader::XLStreamReader(std::string xml, const XLSharedStrings& sharedStrings)
+    : m_sharedStrings(sharedStrings),
+      m_buffer(std::move(xml))
+{}
+
+/**
+ * @details Rows and cells are recognized by their local names, so worksheets that use a namespace prefix for the
+ * spreadsheetml namespace are read as well.
+ */
+bool XLStreamReader::nextRow()
+{
+    readHead();
+    if (m_finished) return false;
+
+    XLTag tag;
+    while (true) {
+        if (!nextTag(tag, nullptr)) throw XLInputError("Unexpected end of worksheet XML");
+
+        if (tag.kind == XLTag::Kind::End) {
+            if (tag.name != "sheetData") continue;
+            m_finished = true;
+            return false;
+        }
+        if (tag.name != "row") {
+            if (tag.kind == XLTag::Kind::Start) skipElement();
+            continue;
+        }
+
+        std::string_view value;
+        m_rowNumber = findAttribute(tag.attributes, "r", value) ? static_cast<uint32_t>(std::strtoul(std::string(value).c_str(), nullptr, 10))
+                                                                : m_rowNumber + 1;
+        m_values.clear();
+        if (tag.kind == XLTag::Kind::Empty) return true;
+
+        uint16_t column = 0;
+        while (true) {
+            if (!nextTag(tag, nullptr)) throw XLInputError("Unexpected end of worksheet XML");
+            if (tag.kind == XLTag::Kind::End) {
+                if (tag.name == "row") break;
+                continue;
+            }
+            if (tag.name != "c") {
+                if (tag.kind == XLTag::Kind::Start) skipElement();
+                continue;
+            }
+
+            // ===== The attribute value is followed by its closing quote (or the end of the tag) in the read buffer, which ends the
+            //       column letters
+            const uint16_t referenced = findAttribute(tag.attributes, "r", value) ? XLCellReference::columnFromAddress(value.data()) : 0;
+            column                    = referenced ? referenced : static_cast<uint16_t>(column + 1);
+            if (column > MAX_COLS) throw XLInputError("Cell column outside of valid range in row " + std::to_string(m_rowNumber));
+
+            const bool        hasType = findAttribute(tag.attributes, "t", value);
+            const std::string type(hasType ? value : std::string_view());
+            if (tag.kind == XLTag::Kind::Empty) {
+                if (m_values.size() < column) m_values.resize(column);
+                continue;
+            }
+            readCell(column, type, hasType);
+        }
+        return true;
+    }
+}
+
+/**
+ * @details
+ */
+const std::string& XLStreamReader::dimension()
+{
+    readHead();
+    return m_dimension;
+}
+
+/**
+ * @details
+ */
+uint32_t XLStreamReader::rowNumber() const { return m_rowNumber; }
+
+/**
+ * @details
+ */
+const std::vector<XLCellValue>& XLStreamReader::values() const { return m_values; }
+
+/**
+ * @details The elements preceding sheetData are small (sheet properties, dimension, views and column formats), so
+ * reading them only decompresses the start of the worksheet entry.
+ */
+void XLStreamReader::readHead()
+{
+    XLTag tag;
+    while (!m_inSheetData && !m_finished) {
+        if (!nextTag(tag, nullptr)) {
+            m_finished = true;
+            return;
+        }
+        if (tag.kind == XLTag::Kind::End) continue;
+
+        std::string_view value;
+        if (tag.name == "dimension" && findAttribute(tag.attributes, "ref", value)) m_dimension.assign(value);
+        else if (tag.name == "sheetData") {
+            if (tag.kind == XLTag::Kind::Empty) m_finished = true;
+            else m_inSheetData = true;
+        }
+    }
+}
+
+/**
+ * @details
+ */
+bool XLStreamReader::fill()
+{
+    if (!m_source) return false;
+
+    const size_t size = m_buffer.size();
+    m_buffer.resize(size + streamChunkSize);
+    const size_t read = m_source(m_buffer.data() + size, streamChunkSize);
+    m_buffer.resize(size + read);
+    if (read == 0) m_source = nullptr;
+    return read != 0;
+}
+
+/**
+ * @details
+ */
+size_t XLStreamReader::find(std::string_view str, size_t from)
+{
+    while (true) {
+        const size_t pos = m_buffer.find(str.data(), from, str.size());
+        if (pos != std::string::npos) return pos;
+        from = m_buffer.size() >= str.size() ? m_buffer.size() - str.size() + 1 : 0;
+        if (!fill()) return std::string::npos;
+    }
+}
+
+/**
+ * @details Consumed data is discarded from the front of the read buffer before a tag is read, so that the buffer only
+ * grows beyond the chunk size for tags or character data that are larger than that.
+ */
+bool XLStreamReader::nextTag(XLTag& tag, std::string* text)
+{
+    if (m_position >= streamChunkSize) {
+        m_buffer.erase(0, m_position);
+        m_position = 0;
+    }
+
+    while (true) {
+        const size_t open = find("<", m_position);
+        if (open == std::string::npos) {
+            if (text) appendDecoded(*text, std::string_view(m_buffer).substr(m_position));
+            m_position = m_buffer.size();
+            return false;
+        }
+        if (text) appendDecoded(*text, std::string_view(m_buffer).substr(m_position, open - m_position));
+        m_position = open;
+
+        // ===== Make sure the characters that identify the kind of markup are in the buffer.
+        while (m_buffer.size() - open < 9 && fill()) {}
+        const std::string_view markup = std::string_view(m_buffer).substr(open);
+
+        if (markup.substr(0, 4) == "<!--" || markup.substr(0, 2) == "<?" || markup.substr(0, 9) == "<![CDATA[") {
+            const bool             cdata      = markup[1] == '!' && markup[2] == '[';
+            const std::string_view terminator = markup[1] == '?' ? "?>" : (cdata ? "]]>" : "-->");
+            const size_t           end        = find(terminator, open + 2);
+            if (end == std::string::npos) throw XLInputError("Unexpected end of worksheet XML");
+            if (cdata && text) text->append(m_buffer, open + 9, end - open - 9);
+            m_position = end + terminator.size();
+            continue;
+        }
+
+        // ===== Find the end of the tag, skipping '>' characters in quoted attribute values.
+        size_t end   = open + 1;
+        char   quote = 0;
+        while (true) {
+            if (end == m_buffer.size() && !fill()) throw XLInputError("Unexpected end of worksheet XML");
+            const char ch = m_buffer[end];
+            if (quote) {
+                if (ch == quote) quote = 0;
+            }
+            else if (ch == '"' || ch == '\'')
+                quote = ch;
+            else if (ch == '>')
+                break;
+            ++end;
+        }
+        m_position = end + 1;
+
+        if (m_buffer[open + 1] == '!') continue;    // DOCTYPE declaration
+
+        std::string_view content = std::string_view(m_buffer).substr(open + 1, end - open - 1);
+        tag.kind                 = XLTag::Kind::Start;
+        if (!content.empty() && content.front() == '/') {
+            tag.kind = XLTag::Kind::End;
+            content.remove_prefix(1);
+        }
+        else if (!content.empty() && content.back() == '/') {
+            tag.kind = XLTag::Kind::Empty;
+            content.remove_suffix(1);
+        }
+
+        size_t nameEnd = 0;
+        while (nameEnd < content.size() && !std::isspace(static_cast<unsigned char>(content[nameEnd]))) ++nameEnd;
+        tag.name       = localName(content.substr(0, nameEnd));
+        tag.attributes = content.substr(nameEnd);
+        return true;
+    }
+}
+
+/**
+ * @details
+ */
+void XLStreamReader::skipElement()
+{
+    XLTag  tag;
+    size_t depth = 1;
+    while (depth > 0) {
+        if (!nextTag(tag, nullptr)) throw XLInputError("Unexpected end of worksheet XML");
+        if (tag.kind == XLTag::Kind::Start)
+            ++depth;
+        else if (tag.kind == XLTag::Kind::End)
+            --depth;
+    }
+}
+
+/**
+ * @details Character data of nested elements is ignored.
+ */
+void XLStreamReader::readText(std::string& text)
+{
+    XLTag tag;
+    while (true) {
+        if (!nextTag(tag, &text)) throw XLInputError("Unexpected end of worksheet XML");
+        if (tag.kind == XLTag::Kind::End) return;
+        if (tag.kind == XLTag::Kind::Start) skipElement();
+    }
+}
+
+/**
+ * @details The value is determined from the t attribute and the v (or, for inline strings, is/t) child element with
+ * the same rules as XLCellValueProxy::type and XLCellValueProxy::getValue.
+ */
+void XLStreamReader::readCell(uint16_t column, const std::string& type, bool hasType)
+{
+    XLTag tag;
+    bool  hasValue = false;
+    bool  hasText  = false;
+    m_text.clear();
+    std::string inlineText;
+
+    while (true) {
+        if (!nextTag(tag, nullptr)) throw XLInputError("Unexpected end of worksheet XML");
+        if (tag.kind == XLTag::Kind::End) break;    // </c>
+        if (tag.kind == XLTag::Kind::Empty) {
+            hasValue = hasValue || tag.name == "v";
+            continue;
+        }
+
+        if (tag.name == "v" && !hasValue) {
+            hasValue = true;
+            readText(m_text);
+        }
+        else if (tag.name == "is") {
+            // ===== Only the first direct t child counts, as for XLCellValueProxy.
+            while (true) {
+                if (!nextTag(tag, nullptr)) throw XLInputError("Unexpected end of worksheet XML");
+                if (tag.kind == XLTag::Kind::End) break;    // </is>
+                if (tag.kind == XLTag::Kind::Empty) {
+                    hasText = hasText || tag.name == "t";
+                    continue;
+                }
+                if (tag.name == "t" && !hasText) {
+                    hasText = true;
+                    readText(inlineText);
+                }
+                else
+                    skipElement();
+            }
+        }
+        else
+            skipElement();
+    }
+
+    if (m_values.size() < column) m_values.resize(column);
+    XLCellValue& value = m_values[column - 1];
+
+    if (!hasType && !hasValue) return;
+
+    if (!hasType || (type == "n" && hasValue)) {
+        if (isFloatText(m_text.data(), m_text.data() + m_text.size()))
+            value = textToFloat(m_text.c_str());
+        else
+            value = textToInteger(m_text.c_str());
+    }
+    else if (type == "s")
+        value = m_sharedStrings.getString(static_cast<int32_t>(std::strtoull(m_text.c_str(), nullptr, 10)));
+    else if (type == "str")
+        value = m_text;
+    else if (type == "inlineStr")
+        value = inlineText;
+    else if (type == "b")
+        value = !m_text.empty() && std::strchr("1tTyY", m_text.front()) != nullptr;
+    else
+        value.setError(m_text);
+}
@@ -0,0 +1,244 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+// ===== External Includes ===== //
+#include <charconv>
+#include <cmath>
+#include <string>
+
+// ===== OpenXLSX Includes ===== //
+#include "XLCellReference.hpp"
+#include "XLConstants.hpp"
+#include "XLException.hpp"
+#include "XLNumberCodec.hpp"
+#include "XLStreamWriter.hpp"
+#include "XLXmlData.hpp"
+
+using namespace OpenXLSX;
+
+namespace
+{
+    constexpr size_t streamChunkSize = 64 * 1024;    // Bytes of XML passed to the sink at a time
+}    // namespace
+
+/**
+ * @details The part of the worksheet before the rows is written right away, so that the archive entry is written front to
+ * back.
+ */
+XLStreamWriter::XLStreamWriter(XLZipEntrySink          sink,
+                               XLXmlData*              xmlData,
+                               const XLSharedStrings&  sharedStrings,
+                               const std::string&      head,
+                               std::string             tail)
+    : m_sink(std::move(sink)),
+      m_xmlData(xmlData),
+      m_sharedStrings(sharedStrings),
+      m_tail(std::move(tail))
+{
+    m_buffer.reserve(streamChunkSize + 1024);
+    if (!head.empty()) m_sink(head.data(), head.size());
+}
+
+/**
+ * @details
+ */
+XLStreamWriter::XLStreamWriter(XLStreamWriter&& other) noexcept
+    : m_sink(std::move(other.m_sink)),
+      m_xmlData(other.m_xmlData),
+      m_sharedStrings(std::move(other.m_sharedStrings)),
+      m_tail(std::move(other.m_tail)),
+      m_buffer(std::move(other.m_buffer)),
+      m_row(std::move(other.m_row)),
+      m_columnNames(std::move(other.m_columnNames)),
+      m_rowNumber(other.m_rowNumber)
+{
+    other.m_sink = nullptr;
+}
+
+/**
+ * @details
+ */
+XLStreamWriter::~XLStreamWriter()
+{
+    try {
+        close();
+    }
+    catch (...) {
+        // Nothing can be reported from a destructor; the worksheet entry is left incomplete.
+    }
+}
+
+/**
+ * @details
+ */
+void XLStreamWriter::appendRow(const std::vector<XLCellValue>& values)
+{
+    appendRow(m_rowNumber + 1, values);
+}
+
+/**
+ * @details Row and cell elements carry their reference, as written by Excel, so that readers need not count elements.
+ */
+void XLStreamWriter::appendRow(uint32_t rowNumber, const std::vector<XLCellValue>& values, uint16_t firstColumn)
+{
+    if (!m_sink) throw XLInputError("XLStreamWriter::appendRow: the writer is closed");
+    if (rowNumber <= m_rowNumber || rowNumber > MAX_ROWS)
+        throw XLInputError("XLStreamWriter::appendRow: row " + std::to_string(rowNumber) + " is out of order or out of bounds");
+    if (firstColumn < 1 || values.size() > static_cast<size_t>(MAX_COLS - firstColumn + 1))
+        throw XLInputError("XLStreamWriter::appendRow: columns are out of bounds");
+
+    m_rowNumber = rowNumber;
+    m_row       = std::to_string(rowNumber);
+    m_buffer += "<row r=\"";
+    m_buffer += m_row;
+    m_buffer += "\">";
+    for (size_t i = 0; i < values.size(); ++i)
+        writeCell(static_cast<uint16_t>(firstColumn + i), values[i]);
+    m_buffer += "</row>";
+
+    if (m_buffer.size() >= streamChunkSize) flush();
+}
+
+/**
+ * @details
+ */
+uint32_t XLStreamWriter::rowNumber() const { return m_rowNumber; }
+
+/**
+ * @details The writer counts as closed even if completing the entry fails, so that the destructor does not write the
+ * remainder of the worksheet a second time. A sink call with a size of 0 completes the entry.
+ */
+void XLStreamWriter::close()
+{
+    if (!m_sink) return;
+
+    const XLZipEntrySink sink = std::move(m_sink);
+    m_sink                    = nullptr;
+
+    m_buffer += m_tail;
+    if (!m_buffer.empty()) sink(m_buffer.data(), m_buffer.size());
+    sink(nullptr, 0);
+    std::string().swap(m_buffer);
+    m_xmlData->discardXmlDocument();
+}
+
+/**
+ * @details The value is written the same way as XLCellValueProxy would set it; non-finite floating point values can not
+ * be held by an XLCellValue, which stores them as the #NUM! error.
+ */
+void XLStreamWriter::writeCell(uint16_t column, const XLCellValue& value)
+{
+    const XLValueType type = value.type();
+    if (type == XLValueType::Empty) return;
+
+    if (m_columnNames.size() < column) m_columnNames.resize(column);
+    std::string& columnName = m_columnNames[column - 1];
+    if (columnName.empty()) columnName = XLCellReference::columnAsString(column);
+
+    m_buffer += "<c r=\"";
+    m_buffer += columnName;
+    m_buffer += m_row;
+    m_buffer += '"';
+
+    char number[XLNumberBufferSize];
+    switch (type) {
+        case XLValueType::Boolean:
+            m_buffer += value.get<bool>() ? " t=\"b\"><v>1</v></c>" : " t=\"b\"><v>0</v></c>";
+            return;
+
+        case XLValueType::Integer: {
+            m_buffer += "><v>";
+            m_buffer.append(number, formatInteger(value.get<int64_t>(), number));
+            break;
+        }
+
+        case XLValueType::Float: {
+            m_buffer += "><v>";
+            m_buffer.append(number, formatFloat(value.get<double>(), number));    // as XLCellValueProxy formats doubles
+            break;
+        }
+
+        case XLValueType::String: {
+            const std::string str   = value.get<std::string>();
+            int32_t           index = m_sharedStrings.getStringIndex(str);
+            if (index < 0) index = m_sharedStrings.appendString(str);
+            const auto result = std::to_chars(number, number + sizeof(number), index);
+            m_buffer += " t=\"s\"><v>";
+            m_buffer.append(number, result.ptr);
+            break;
+        }
+
+        default:    // XLValueType::Error
+            m_buffer += " t=\"e\"><v>";
+            writeEscaped(value.get<std::string>());
+            break;
+    }
+    m_buffer += "</v></c>";
+}
+
+/**
+ * @details
+ */
+void XLStreamWriter::writeEscaped(const std::string& str)
+{
+    for (const char ch : str) {
+        switch (ch) {
+            case '&': m_buffer += "&amp;"; break;
+            case '<': m_buffer += "&lt;"; break;
+            case '>': m_buffer += "&gt;"; break;
+            case '"': m_buffer += "&quot;"; break;
+            default: m_buffer += ch;
+        }
+    }
+}
+
+/**
+ * @details
+ */
+void XLStreamWriter::flush()
+{
+    m_sink(m_buffer.data(), m_buffer.size());
+    m_buffer.clear();
+}
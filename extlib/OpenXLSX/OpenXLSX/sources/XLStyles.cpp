@@ -50,6 +50,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #include <pugixml.hpp>
 #include <stdexcept>    // std::invalid_argument
 #include <string>       // std::stoi, std::literals::string_literals
+#include <string_view>  // std::string_view
 #include <vector>       // std::vector
 
 // ===== OpenXLSX Includes ===== //
@@ -442,6 +443,87 @@ namespace     // anonymous namespace for module local functions
         if (val < min) val = min; else if (val > max) val = max;             // fix rounding errors within tolerance
         return formatDoubleAsString(val, decimalPlaces);
     }
+    /**
+     * @brief Append a representation of node to signature that covers element names, attributes and text, but not the whitespace
+     *        used to format the XML, so that style entries with the same content yield the same signature
+     * @param signature the string to append to
+     * @param node the style entry node
+     * @param ignoredAttribute name of an attribute of node (not of its children) that is not part of its content, or nullptr
+     */
+    void appendStyleSignature(std::string & signature, XMLNode node, const char * ignoredAttribute = nullptr)
+    {
+        signature += '<';
+        signature += node.name();
+        for (XMLAttribute attr = node.first_attribute(); not attr.empty(); attr = attr.next_attribute()) {
+            if (ignoredAttribute != nullptr && std::string_view(attr.name()) == ignoredAttribute) continue;
+            signature += ' ';
+            signature += attr.name();
+            signature += "=\"";
+            signature += attr.value();
+            signature += '"';
+        }
+        signature += '>';
+        for (XMLNode child = node.first_child(); not child.empty(); child = child.next_sibling()) {
+            if (child.type() == pugi::node_element)
+                appendStyleSignature(signature, child);
+            else if (child.type() == pugi::node_pcdata && std::string_view(child.value()).find_first_not_of(" \t\r\n") != std::string_view::npos)
+                signature += child.value();
+        }
+        signature += "</>";
+    }
+
+    /**
+     * @brief Common implementation of the intern functions of the style entry collections
+     * @param entriesNode the XML node holding the style entries, e.g. fonts
+     * @param entries the style entry objects of the collection, in XML order
+     * @param signatures the signature index of the collection, built on first use
+     * @param index the index of the entry to deduplicate
+     * @param nodeOf a function returning the XML node of a style entry object
+     * @param ignoredAttribute passed on to appendStyleSignature
+     * @return the index of the first entry with the same content as the entry at index
+     * @note signatures may be outdated if entries were modified after being indexed, therefore a hit is only accepted after comparing
+     *       the signature of the found entry once more
+     */
+    template<class Entry, class NodeOf>
+    XLStyleIndex internStyleEntry(XMLNode & entriesNode, std::vector<Entry> & entries, XLStyleSignatures & signatures,
+                                  XLStyleIndex index, NodeOf nodeOf, const char * ignoredAttribute = nullptr)
+    {
+        if (index >= entries.size()) {
+            using namespace std::literals::string_literals;
+            throw XLException("internStyleEntry: attempted to access index "s + std::to_string(index) + " with count "s + std::to_string(entries.size()));
+        }
+
+        auto signatureOf = [&](XLStyleIndex i) {
+            std::string signature;
+            appendStyleSignature(signature, nodeOf(entries[i]), ignoredAttribute);
+            return signature;
+        };
+
+        if (signatures.empty())
+            for (XLStyleIndex i = 0; i < entries.size(); ++i) signatures.emplace(signatureOf(i), i);    // first occurrence is kept
+
+        const std::string signature = signatureOf(index);
+        const auto found = signatures.find(signature);
+        if (found == signatures.end()) {
+            signatures.emplace(signature, index);
+            return index;
+        }
+        if (found->second == index) return index;
+        if (found->second >= entries.size() || signatureOf(found->second) != signature) {    // outdated entry in the index
+            found->second = index;
+            return index;
+        }
+
+        // ===== A duplicate exists: remove the entry at index, if that can be done without shifting other indexes
+        if (index + 1 == entries.size()) {
+            XMLNode node = nodeOf(entries[index]);
+            while (node.previous_sibling().type() == pugi::node_pcdata) entriesNode.remove_child(node.previous_sibling());
+            entriesNode.remove_child(node);
+            entries.pop_back();
+            appendAndSetAttribute(entriesNode, "count", std::to_string(entries.size()));
+        }
+        return found->second;
+    }
 }    // anonymous namespace
 
 
@@ -626,6 +708,14 @@ XLStyleIndex XLNumberFormats::create(XLNumberFormat copyFrom, std::string styleE
     return index;
 }
 
+/**
+ * @details
+ */
+XLStyleIndex XLNumberFormats::intern(XLStyleIndex index)
+{
+    return internStyleEntry(*m_numberFormatsNode, m_numberFormats, m_signatures, index, [](const XLNumberFormat& entry) { return *entry.m_numberFormatNode; }, "numFmtId");
+}
+
 
 /**
  * @details Constructor. Initializes an empty XLFont object
@@ -864,6 +954,14 @@ XLStyleIndex XLFonts::create(XLFont copyFrom, std::string styleEntriesPrefix)
     return index;
 }
 
+/**
+ * @details
+ */
+XLStyleIndex XLFonts::intern(XLStyleIndex index)
+{
+    return internStyleEntry(*m_fontsNode, m_fonts, m_signatures, index, [](const XLFont& entry) { return *entry.m_fontNode; });
+}
+
 
 // ===== XLDataBarColor, used by XLFills gradientFill and by XLLine (to be implemented)
 
@@ -1423,6 +1521,14 @@ XLStyleIndex XLFills::create(XLFill copyFrom, std::string styleEntriesPrefix)
     return index;
 }
 
+/**
+ * @details
+ */
+XLStyleIndex XLFills::intern(XLStyleIndex index)
+{
+    return internStyleEntry(*m_fillsNode, m_fills, m_signatures, index, [](const XLFill& entry) { return *entry.m_fillNode; });
+}
+
 
 /**
  * @details Constructor. Initializes an empty XLLine object
@@ -1709,6 +1815,14 @@ XLStyleIndex XLBorders::create(XLBorder copyFrom, std::string styleEntriesPrefix
     return index;
 }
 
+/**
+ * @details
+ */
+XLStyleIndex XLBorders::intern(XLStyleIndex index)
+{
+    return internStyleEntry(*m_bordersNode, m_borders, m_signatures, index, [](const XLBorder& entry) { return *entry.m_borderNode; });
+}
+
 
 /**
  * @details Constructor. Initializes an empty XLAlignment object
@@ -2089,6 +2203,14 @@ XLStyleIndex XLCellFormats::create(XLCellFormat copyFrom, std::string styleEntri
     return index;
 }
 
+/**
+ * @details
+ */
+XLStyleIndex XLCellFormats::intern(XLStyleIndex index)
+{
+    return internStyleEntry(*m_cellFormatsNode, m_cellFormats, m_signatures, index, [](const XLCellFormat& entry) { return *entry.m_cellFormatNode; });
+}
+
 
 /**
  * @details Constructor. Initializes an empty XLCellStyle object
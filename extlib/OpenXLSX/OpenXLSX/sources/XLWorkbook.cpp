@@ -78,29 +78,94 @@ XLWorkbook::XLWorkbook(XLXmlData* xmlData) : XLXmlFile(xmlData) {}
  */
 XLWorkbook::~XLWorkbook() = default;
 
+/**
+ * @details
+ */
+XMLNode XLWorkbook::sheetNodeByName(const std::string& sheetName) const
+{
+    return m_xmlData->getNodeIndex("name")->findNode(sheetsNode(xmlDocument()), sheetName);
+}
+
+/**
+ * @details
+ */
+XMLNode XLWorkbook::sheetNodeByID(const std::string& sheetRID) const
+{
+    return m_xmlData->getNodeIndex("r:id")->findNode(sheetsNode(xmlDocument()), sheetRID);
+}
+
 /**
  * @details
  */
 XLSheet XLWorkbook::sheet(const std::string& sheetName)
 {
-    // ===== First determine if the sheet exists.
-    if (xmlDocument().document_element().child("sheets").find_child_by_attribute("name", sheetName.c_str()) == nullptr)
-        throw XLInputError("Sheet \"" + sheetName + "\" does not exist");
+    XLQuery xmlQuery(XLQueryType::QueryXmlData);
+    xmlQuery.setParam("xmlPath", sheetXmlPath(sheetName));
+    return XLSheet(parentDoc().execQuery(xmlQuery).result<XLXmlData*>());
+}
 
-    // ===== Find the sheet data corresponding to the sheet with the requested name
-    const std::string xmlID =
-        xmlDocument().document_element().child("sheets").find_child_by_attribute("name", sheetName.c_str()).attribute("r:id").value();
+/**
+ * @details The worksheet XML is decompressed from the archive as the reader advances. A worksheet whose XML document has
+ * been handed out may hold changes that are not in the archive yet; its XML document is serialized and read instead.
+ */
+XLStreamReader XLWorkbook::streamWorksheet(const std::string& sheetName)
+{
+    if (!worksheetExists(sheetName)) throw XLInputError("Worksheet \"" + sheetName + "\" does not exist");
 
-    XLQuery pathQuery(XLQueryType::QuerySheetRelsTarget);
-    pathQuery.setParam("sheetID", xmlID);
-    auto xmlPath = parentDoc().execQuery(pathQuery).result<std::string>();
+    const std::string xmlPath = sheetXmlPath(sheetName);
+    XLQuery           xmlQuery(XLQueryType::QueryXmlData);
+    xmlQuery.setParam("xmlPath", xmlPath);
+    const auto* xmlData = parentDoc().execQuery(xmlQuery).result<XLXmlData*>();
 
-    // Some spreadsheets use absolute rather than relative paths in relationship items.
-    if (xmlPath.substr(0, 4) == "/xl/") xmlPath = xmlPath.substr(4);
+    if (xmlData->isDirty() || !parentDoc().m_archive.hasEntry(xmlPath))
+        return XLStreamReader(xmlData->getRawData(), parentDoc().sharedStrings());
+    return XLStreamReader(parentDoc().m_archive.openEntryStream(xmlPath), parentDoc().sharedStrings());
+}
 
-    XLQuery xmlQuery(XLQueryType::QueryXmlData);
-    xmlQuery.setParam("xmlPath", "xl/" + xmlPath);
-    return XLSheet(parentDoc().execQuery(xmlQuery).result<XLXmlData*>());
+/**
+ * @details The rows are removed from the XML document of the worksheet, which is then serialized and split around the
+ * empty sheetData element: the part before it is written by the writer right away, the part after it when the writer is
+ * closed. The dimension element is removed, as the extent of the new rows is not known up front; it is optional.
+ */
+XLStreamWriter XLWorkbook::worksheetWriter(const std::string& sheetName, int compressionLevel)
+{
+    if (!worksheetExists(sheetName)) throw XLInputError("Worksheet \"" + sheetName + "\" does not exist");
+
+    const std::string xmlPath = sheetXmlPath(sheetName);
+    XLQuery           xmlQuery(XLQueryType::QueryXmlData);
+    xmlQuery.setParam("xmlPath", xmlPath);
+    auto* xmlData = parentDoc().execQuery(xmlQuery).result<XLXmlData*>();
+
+    XMLNode rootNode      = xmlData->getXmlDocument()->document_element();
+    XMLNode sheetDataNode = rootNode.child("sheetData");
+    if (sheetDataNode.empty()) throw XLInputError("Worksheet \"" + sheetName + "\" has no sheetData element");
+    sheetDataNode.remove_children();
+    rootNode.remove_child("dimension");
+    xmlData->getRowIndex()->invalidate();
+
+    const std::string xml   = xmlData->getRawData(parentDoc().m_xmlSavingDeclaration);
+    const size_t      begin = xml.find("<sheetData");
+    const size_t      end   = begin == std::string::npos ? std::string::npos : xml.find('>', begin);
+    if (end == std::string::npos) throw XLInternalError("Worksheet \"" + sheetName + "\" could not be serialized");
+
+    std::string head;
+    std::string tail;
+    if (xml[end - 1] == '/') {    // <sheetData/> or <sheetData />
+        head = xml.substr(0, begin) + "<sheetData>";
+        tail = "</sheetData>" + xml.substr(end + 1);
+    }
+    else {
+        const size_t close = xml.find("</sheetData>", end);
+        if (close == std::string::npos) throw XLInternalError("Worksheet \"" + sheetName + "\" could not be serialized");
+        head = xml.substr(0, end + 1);
+        tail = xml.substr(close);
+    }
+
+    return XLStreamWriter(parentDoc().m_archive.openEntrySink(xmlPath, compressionLevel),
+                          xmlData,
+                          parentDoc().sharedStrings(),
+                          head,
+                          std::move(tail));
 }
 
 /**
@@ -183,7 +248,7 @@ void XLWorkbook::deleteSheet(const std::string& sheetName)    // 2024-05-02: whi
                                                               // CAUTION: execCommand on underlying XML with whitespaces not verified
 {
     // ===== Determine ID and type of sheet, as well as current worksheet count.
-    std::string sheetID = sheetsNode(xmlDocument()).find_child_by_attribute("name", sheetName.c_str()).attribute("r:id").value();    // NOLINT
+    std::string sheetID = sheetNodeByName(sheetName).attribute("r:id").value();    // NOLINT
     if (sheetID.length() == 0) { // 2025-01-12 BUGFIX: prevent segfault by throwing
         using namespace std::literals::string_literals;
         throw XLException("XLWorkbook::deleteSheet: workbook has no sheet with name \""s + sheetName + "\""s);
@@ -209,7 +274,7 @@ void XLWorkbook::deleteSheet(const std::string& sheetName)    // 2024-05-02: whi
     // ===== Delete the sheet data as well as the sheet node from Workbook.xml
     parentDoc().execCommand(
         XLCommand(XLCommandType::DeleteSheet).setParam("sheetID", std::string(sheetID)).setParam("sheetName", sheetName));
-    XMLNode sheet = sheetsNode(xmlDocument()).find_child_by_attribute("name", sheetName.c_str());
+    XMLNode sheet = sheetNodeByName(sheetName);
     if (not sheet.empty()) {
         // ===== Delete all non element nodes (comments, whitespaces) following the sheet being deleted from workbook.xml <sheets> node
         XMLNode nonElementNode = sheet.next_sibling();
@@ -217,6 +282,8 @@ void XLWorkbook::deleteSheet(const std::string& sheetName)    // 2024-05-02: whi
             sheetsNode(xmlDocument()).remove_child(nonElementNode);
             nonElementNode = nonElementNode.next_sibling();
         }
+        m_xmlData->getNodeIndex("name")->eraseNode(sheet);
+        m_xmlData->getNodeIndex("r:id")->eraseNode(sheet);
         sheetsNode(xmlDocument()).remove_child(sheet);    // delete the actual sheet entry
     }
 
@@ -230,8 +297,7 @@ void XLWorkbook::deleteSheet(const std::string& sheetName)    // 2024-05-02: whi
 void XLWorkbook::addWorksheet(const std::string& sheetName)
 {
     // ===== If a sheet with the given name already exists, throw an exception.
-    if (xmlDocument().document_element().child("sheets").find_child_by_attribute("name", sheetName.c_str()))
-        throw XLInputError("Sheet named \"" + sheetName + "\" already exists.");
+    if (not sheetNodeByName(sheetName).empty()) throw XLInputError("Sheet named \"" + sheetName + "\" already exists.");
 
     // ===== Create new internal (workbook) ID for the sheet
     auto internalID = createInternalSheetID();
@@ -269,12 +335,34 @@ uint16_t XLWorkbook::createInternalSheetID()    // 2024-04-30: whitespace suppor
     return maxSheetIdFound + 1;
 }
 
+/**
+ * @details
+ */
+std::string XLWorkbook::sheetXmlPath(const std::string& sheetName)
+{
+    // ===== First determine if the sheet exists.
+    const XMLNode sheet = sheetNodeByName(sheetName);
+    if (sheet.empty()) throw XLInputError("Sheet \"" + sheetName + "\" does not exist");
+
+    // ===== Find the sheet data corresponding to the sheet with the requested name
+    const std::string xmlID = sheet.attribute("r:id").value();
+
+    XLQuery pathQuery(XLQueryType::QuerySheetRelsTarget);
+    pathQuery.setParam("sheetID", xmlID);
+    auto xmlPath = parentDoc().execQuery(pathQuery).result<std::string>();
+
+    // Some spreadsheets use absolute rather than relative paths in relationship items.
+    if (xmlPath.substr(0, 4) == "/xl/") xmlPath = xmlPath.substr(4);
+
+    return "xl/" + xmlPath;
+}
+
 /**
  * @details
  */
 std::string XLWorkbook::sheetID(const std::string& sheetName)
 {
-    return xmlDocument().document_element().child("sheets").find_child_by_attribute("name", sheetName.c_str()).attribute("r:id").value();
+    return sheetNodeByName(sheetName).attribute("r:id").value();
 }
 
 /**
@@ -282,7 +370,7 @@ std::string XLWorkbook::sheetID(const std::string& sheetName)
  */
 std::string XLWorkbook::sheetName(const std::string& sheetID) const
 {
-    return xmlDocument().document_element().child("sheets").find_child_by_attribute("r:id", sheetID.c_str()).attribute("name").value();
+    return sheetNodeByID(sheetID).attribute("name").value();
 }
 
 /**
@@ -290,7 +378,7 @@ std::string XLWorkbook::sheetName(const std::string& sheetID) const
  */
 std::string XLWorkbook::sheetVisibility(const std::string& sheetID) const
 {
-    return xmlDocument().document_element().child("sheets").find_child_by_attribute("r:id", sheetID.c_str()).attribute("state").value();
+    return sheetNodeByID(sheetID).attribute("state").value();
 }
 
 /**
@@ -316,10 +404,14 @@ void XLWorkbook::prepareSheetMetadata(const std::string& sheetName, uint16_t int
  */
 void XLWorkbook::setSheetName(const std::string& sheetRID, const std::string& newName)
 {
-    auto sheetName = xmlDocument().document_element().child("sheets").find_child_by_attribute("r:id", sheetRID.c_str()).attribute("name");
+    XMLNode sheet     = sheetNodeByID(sheetRID);
+    auto    sheetName = sheet.attribute("name");
 
     updateSheetReferences(sheetName.value(), newName);
+    XLNodeIndex* nameIndex = m_xmlData->getNodeIndex("name");
+    nameIndex->eraseNode(sheet);
     sheetName.set_value(newName.c_str());
+    nameIndex->insertNode(sheet);
 }
 
 /**
@@ -344,17 +436,13 @@ void XLWorkbook::setSheetVisibility(const std::string& sheetRID, const std::stri
     if (hideSheet && visibleSheets == 0) throw XLSheetError("At least one sheet must be visible.");
 
     // ===== Then, retrieve or create the visibility ("state") attribute for the sheet, and set it to the "state" value
-    auto stateAttribute =
-        xmlDocument().document_element().child("sheets").find_child_by_attribute("r:id", sheetRID.c_str()).attribute("state");
-    if (stateAttribute.empty()) {
-        stateAttribute =
-            xmlDocument().document_element().child("sheets").find_child_by_attribute("r:id", sheetRID.c_str()).prepend_attribute("state");
-    }
+    XMLNode sheet          = sheetNodeByID(sheetRID);
+    auto    stateAttribute = sheet.attribute("state");
+    if (stateAttribute.empty()) stateAttribute = sheet.prepend_attribute("state");
     stateAttribute.set_value(state.c_str());
 
     // Next, find the index of the sheet...
-    std::string name =
-        xmlDocument().document_element().child("sheets").find_child_by_attribute("r:id", sheetRID.c_str()).attribute("name").value();
+    std::string name = sheet.attribute("name").value();
     auto index = indexOfSheet(name) - 1;    // 2024-05-01: activeTab property stores an array index, NOT the value of r_ID?
 
     // ...and determine the index of the active sheet
@@ -591,8 +679,12 @@ bool XLWorkbook::sheetExists(const std::string& sheetName) const { return charts
  */
 bool XLWorkbook::worksheetExists(const std::string& sheetName) const
 {
-    auto wksNames = worksheetNames();
-    return std::find(wksNames.begin(), wksNames.end(), sheetName) != wksNames.end();
+    const XMLNode sheet = sheetNodeByName(sheetName);
+    if (sheet.empty()) return false;
+
+    XLQuery query(XLQueryType::QuerySheetType);
+    query.setParam("sheetID", std::string(sheet.attribute("r:id").value()));
+    return parentDoc().execQuery(query).result<XLContentType>() == XLContentType::Worksheet;
 }
 
 /**
@@ -600,8 +692,12 @@ bool XLWorkbook::worksheetExists(const std::string& sheetName) const
  */
 bool XLWorkbook::chartsheetExists(const std::string& sheetName) const
 {
-    auto chsNames = chartsheetNames();
-    return std::find(chsNames.begin(), chsNames.end(), sheetName) != chsNames.end();
+    const XMLNode sheet = sheetNodeByName(sheetName);
+    if (sheet.empty()) return false;
+
+    XLQuery query(XLQueryType::QuerySheetType);
+    query.setParam("sheetID", std::string(sheet.attribute("r:id").value()));
+    return parentDoc().execQuery(query).result<XLContentType>() == XLContentType::Chartsheet;
 }
 
 /**
@@ -77,6 +77,9 @@ XLXmlData::~XLXmlData() = default;
 void XLXmlData::setRawData(const std::string& data) // NOLINT
 {
     m_xmlDoc->load_string(data.c_str(), pugi_parse_settings);
+    if (m_rowIndex) m_rowIndex->invalidate();
+    for (auto& nodeIndex : m_nodeIndices) nodeIndex->invalidate();
+    m_dirty = true;
 }
 
 /**
@@ -165,8 +168,8 @@ XLContentType XLXmlData::getXmlType() const
  */
 XMLDocument* XLXmlData::getXmlDocument()
 {
-    if (!m_xmlDoc->document_element())
-        m_xmlDoc->load_string(m_parentDoc->extractXmlFromArchive(m_xmlPath).c_str(), pugi_parse_settings);
+    loadXmlDocument();
+    m_dirty = true;
 
     return m_xmlDoc.get();
 }
@@ -176,8 +179,57 @@ XMLDocument* XLXmlData::getXmlDocument()
  */
 const XMLDocument* XLXmlData::getXmlDocument() const
 {
-    if (!m_xmlDoc->document_element())
-        m_xmlDoc->load_string(m_parentDoc->extractXmlFromArchive(m_xmlPath).c_str(), pugi_parse_settings);
+    loadXmlDocument();
+    m_dirty = true;
 
     return m_xmlDoc.get();
 }
+
+/**
+ * @details Parsing alone does not make the document dirty: no XMLNode handles have been handed out yet.
+ */
+void XLXmlData::loadXmlDocument() const
+{
+    if (!m_xmlDoc->document_element())
+        m_parentDoc->extractXmlFromArchive(m_xmlPath, *m_xmlDoc);
+}
+
+/**
+ * @details
+ */
+XLRowIndex* XLXmlData::getRowIndex() const
+{
+    if (!m_rowIndex) m_rowIndex = std::make_unique<XLRowIndex>();
+
+    return m_rowIndex.get();
+}
+
+/**
+ * @details
+ */
+XLNodeIndex* XLXmlData::getNodeIndex(const std::string& attributeName) const
+{
+    for (auto& nodeIndex : m_nodeIndices)
+        if (nodeIndex->attributeName() == attributeName) return nodeIndex.get();
+
+    return m_nodeIndices.emplace_back(std::make_unique<XLNodeIndex>(attributeName)).get();
+}
+
+/**
+ * @details
+ */
+bool XLXmlData::isDirty() const
+{
+    return m_dirty;
+}
+
+/**
+ * @details
+ */
+void XLXmlData::discardXmlDocument()
+{
+    m_xmlDoc->reset();
+    m_rowIndex.reset();
+    m_nodeIndices.clear();
+    m_dirty = false;
+}
@@ -95,8 +95,9 @@ namespace OpenXLSX
     }
 
     /**
-     * @details for creation of node children: copy this node's namespace without thread safety, using
-     *  a static character array to avoid smart pointer performance impact
+     * @details for creation of node children: copy this node's namespace using a thread_local character array to
+     *  avoid smart pointer performance impact. Each thread has its own buffer, so that documents can be processed on
+     *  different threads concurrently. The returned pointer is only valid until the next call on the same thread.
      */
     const pugi::char_t* XMLNode::namespaced_name_char(const pugi::char_t* name_, bool force_ns) const
     {
@@ -107,7 +108,7 @@ namespace OpenXLSX
         throw XLException("OpenXLSX_xml_node::"s + __func__ + ": strlen of "s + name_ + " exceeds XLMaxNamespacedNameLen "s + std::to_string(XLMaxNamespacedNameLen));
         }
 
-        static pugi::char_t namespaced_name_[ XLMaxNamespacedNameLen + 1 ]; // static memory allocation for concatenating node namespace and name_
+        thread_local pugi::char_t namespaced_name_[ XLMaxNamespacedNameLen + 1 ]; // per thread static memory for concatenating node namespace and name_
 
         // ===== If node has a namespace: create a namespaced version of name_
         memcpy(namespaced_name_, xml_node::name(), name_begin);    // copy the node namespace
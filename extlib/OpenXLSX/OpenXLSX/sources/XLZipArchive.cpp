@@ -44,6 +44,8 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
  */
 
 // ===== External Includes ===== //
+#include <algorithm>
+#include <thread>
 #include <zippy.hpp>
 
 // ===== OpenXLSX Includes ===== //
@@ -51,6 +53,40 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 
 using namespace OpenXLSX;
 
+namespace
+{
+    /**
+     * @brief Match a name against a pattern in which '*' matches any sequence of characters.
+     */
+    bool matchesPattern(const std::string& name, const std::string& pattern)
+    {
+        size_t n        = 0;
+        size_t p        = 0;
+        size_t lastStar = std::string::npos;    // position of the last '*' in the pattern
+        size_t starFrom = 0;                    // position in the name where that '*' started matching
+
+        while (n < name.size()) {
+            if (p < pattern.size() && pattern[p] == '*') {
+                lastStar = p++;
+                starFrom = n;
+            }
+            else if (p < pattern.size() && pattern[p] == name[n]) {
+                ++p;
+                ++n;
+            }
+            else if (lastStar != std::string::npos) {    // let the last '*' absorb one more character and retry
+                p = lastStar + 1;
+                n = ++starFrom;
+            }
+            else
+                return false;
+        }
+        while (p < pattern.size() && pattern[p] == '*') ++p;
+
+        return p == pattern.size();
+    }
+}    // namespace
+
 /**
  * @details
  */
@@ -106,9 +142,17 @@ void XLZipArchive::close()
 /**
  * @details
  */
-void XLZipArchive::save(const std::string& path) // NOLINT
+void XLZipArchive::save(const std::string& path, const XLZipSaveOptions& options) // NOLINT
 {
-    m_archive->Save(path);
+    unsigned threadCount = options.threadCount;
+    if (threadCount == 0) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    auto levelForEntry = [&options](const std::string& entryName) {
+        for (const auto& rule : options.rules)
+            if (matchesPattern(entryName, rule.pattern)) return rule.compressionLevel;
+        return options.compressionLevel;
+    };
+    m_archive->Save(path, levelForEntry, threadCount);
 }
 
 /**
@@ -140,3 +184,33 @@ std::string XLZipArchive::getEntry(const std::string& name) const {
 bool XLZipArchive::hasEntry(const std::string& entryName) const {
     return m_archive->HasEntry(entryName);
 }
+
+/**
+ * @details
+ */
+void* XLZipArchive::getEntryBuffer(const std::string& name, size_t& size, void* (*allocate)(size_t), void (*deallocate)(void*)) const {
+    return m_archive->ExtractEntryToBuffer(name, size, allocate, deallocate);
+}
+
+/**
+ * @details
+ */
+XLZipEntryStream XLZipArchive::openEntryStream(const std::string& name) const {
+    return m_archive->OpenEntryStream(name);
+}
+
+/**
+ * @details
+ */
+XLZipEntrySink XLZipArchive::openEntrySink(const std::string& name, int compressionLevel) {
+    return m_archive->OpenEntryWriter(name, compressionLevel);
+}
+
+/**
+ * @details
+ */
+void XLZipArchive::prefetchEntries(const std::vector<std::string>& names, unsigned threadCount)
+{
+    if (threadCount == 0) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    m_archive->PrefetchEntries(names, threadCount);
+}
@@ -5,6 +5,8 @@
 #ifndef OPENXLSX_XLUTILITIES_HPP
 #define OPENXLSX_XLUTILITIES_HPP
 
+#include <algorithm>    // std::min, std::max
+#include <charconv>     // std::to_chars
 #include <fstream>
 #include <pugixml.hpp>
 #include <string>       // 2024-04-25 needed for xml_node_type_string
@@ -16,6 +18,7 @@
 #include "XLCellValue.hpp"        // OpenXLSX::XLValueType
 #include "XLContentTypes.hpp"     // OpenXLSX::XLContentType
 #include "XLRelationships.hpp"    // OpenXLSX::XLRelationshipType
+#include "XLRowIndex.hpp"         // OpenXLSX::XLRowIndex
 #include "XLStyles.hpp"           // OpenXLSX::XLStyleIndex
 #include "XLXmlParser.hpp"
 
@@ -147,10 +150,13 @@ namespace OpenXLSX
     }
 
     /**
-     * @details
+     * @details If a rowIndex is given, the lookup (and insertion of a missing row) is delegated to it, otherwise the
+     * sheetData node is searched linearly from the nearer end
      */
-    inline XMLNode getRowNode(XMLNode sheetDataNode, uint32_t rowNumber)
+    inline XMLNode getRowNode(XMLNode sheetDataNode, uint32_t rowNumber, XLRowIndex* rowIndex = nullptr)
     {
+        if (rowIndex != nullptr) return rowIndex->getRowNode(sheetDataNode, rowNumber);
+
         if (rowNumber < 1 || rowNumber > OpenXLSX::MAX_ROWS) {    // 2024-05-28: added range check
             using namespace std::literals::string_literals;
             throw XLCellAddressError("rowNumber "s + std::to_string( rowNumber ) + " is outside valid range [1;"s + std::to_string(OpenXLSX::MAX_ROWS) + "]"s);
@@ -222,9 +228,146 @@ namespace OpenXLSX
         return XLDefaultCellFormat; // if no col style was found
     }
 
+    /**
+     * @brief The bounding box of all cells in a worksheet, as kept in the ref attribute of the worksheet's <dimension> element
+     * @note The ref is written as Excel writes it: "A1:B2", or "C5" for a single cell. A worksheet without cells has the ref
+     *  "A1" as well, so that ref only denotes the cell A1 if that cell exists (see readSheetDimension).
+     */
+    struct XLSheetDimension
+    {
+        uint32_t firstRow    { 0 };    // 0 if the worksheet has no cells
+        uint16_t firstColumn { 0 };
+        uint32_t lastRow     { 0 };
+        uint16_t lastColumn  { 0 };
+
+        bool empty() const { return firstRow == 0; }
+
+        /**
+         * @brief extend the bounding box so that it includes the cell at row, column
+         * @return true if the bounding box was changed
+         */
+        bool include(uint32_t row, uint16_t column)
+        {
+            if (empty()) {
+                firstRow = lastRow = row;
+                firstColumn = lastColumn = column;
+                return true;
+            }
+            const XLSheetDimension before = *this;
+            firstRow    = std::min(firstRow, row);
+            lastRow     = std::max(lastRow, row);
+            firstColumn = std::min(firstColumn, column);
+            lastColumn  = std::max(lastColumn, column);
+            return firstRow != before.firstRow || lastRow != before.lastRow || firstColumn != before.firstColumn || lastColumn != before.lastColumn;
+        }
+    };
+
+    /**
+     * @brief parse a cell address such as "AB12" at the start of address
+     * @return a pointer behind the address, or nullptr if address does not start with a valid cell address
+     */
+    inline const char* parseCellAddress(const char* address, uint32_t& row, uint16_t& column)
+    {
+        column = XLCellReference::columnFromAddress(address);
+        if (column == 0) return nullptr;
+        while (*address >= 'A' && *address <= 'Z') ++address;
+        const char* digits = address;
+        uint64_t    value  = 0;
+        for (; *address >= '0' && *address <= '9' && value <= MAX_ROWS; ++address) value = value * 10 + static_cast<uint64_t>(*address - '0');
+        if (address == digits || value < 1 || value > MAX_ROWS) return nullptr;
+        row = static_cast<uint32_t>(value);
+        return address;
+    }
+
+    /**
+     * @brief parse the ref attribute of a <dimension> element
+     * @param ref the attribute value, e.g. "A1:H100", or "C5" for a single cell
+     * @return the bounding box, which is empty if ref is not a valid range
+     * @note "A1" is returned as the cell A1; use readSheetDimension to tell it apart from a worksheet without cells
+     */
+    inline XLSheetDimension parseSheetDimension(const char* ref)
+    {
+        XLSheetDimension dimension;
+        uint32_t         row    = 0;
+        uint16_t         column = 0;
+        ref                     = parseCellAddress(ref, row, column);
+        if (ref == nullptr) return XLSheetDimension{};
+        dimension.include(row, column);
+        if (*ref == 0) return dimension;
+        if (*ref != ':' || (ref = parseCellAddress(ref + 1, row, column)) == nullptr || *ref != 0) return XLSheetDimension{};
+        dimension.include(row, column);
+        return dimension;
+    }
+
+    /**
+     * @brief format a bounding box as the ref attribute of a <dimension> element
+     * @param dimension the bounding box
+     * @param buffer receives the ref, which is not zero-terminated, and must hold at least 21 characters
+     * @return the length of the ref written to buffer
+     */
+    inline size_t formatSheetDimension(const XLSheetDimension& dimension, char* buffer)
+    {
+        if (dimension.empty()) {
+            buffer[0] = 'A';
+            buffer[1] = '1';
+            return 2;
+        }
+        auto formatAddress = [](uint32_t row, uint16_t column, char* out) {
+            char letters[3];    // MAX_COLS has three letters
+            int  count = 0;
+            for (; column > 0; column = static_cast<uint16_t>((column - 1) / 26)) letters[count++] = static_cast<char>('A' + (column - 1) % 26);
+            while (count > 0) *out++ = letters[--count];
+            return std::to_chars(out, out + 7, row).ptr;    // MAX_ROWS has seven digits
+        };
+        char* end = formatAddress(dimension.firstRow, dimension.firstColumn, buffer);
+        if (dimension.lastRow != dimension.firstRow || dimension.lastColumn != dimension.firstColumn) {
+            *end++ = ':';
+            end    = formatAddress(dimension.lastRow, dimension.lastColumn, end);
+        }
+        return static_cast<size_t>(end - buffer);
+    }
+
+    /**
+     * @brief read the bounding box of all cells from the <dimension> element of a worksheet
+     * @param sheetNode the document element of the worksheet
+     * @return the bounding box, which is empty if the worksheet has no cells or no valid <dimension>
+     * @note the ref "A1" is ambiguous, see XLSheetDimension. As rows and cells are kept in order, the cell A1 exists if and only if it
+     *  is the first cell of the first row, so this takes constant time.
+     */
+    inline XLSheetDimension readSheetDimension(XMLNode sheetNode)
+    {
+        const XLSheetDimension dimension = parseSheetDimension(sheetNode.child("dimension").attribute("ref").value());
+        if (dimension.lastRow != 1 || dimension.lastColumn != 1) return dimension;
+
+        const XMLNode firstRow = sheetNode.child("sheetData").first_child_of_type(pugi::node_element);
+        if (firstRow.attribute("r").as_ullong() == 1 &&
+            XLCellReference::columnFromAddress(firstRow.first_child_of_type(pugi::node_element).attribute("r").value()) == 1)
+            return dimension;
+        return XLSheetDimension{};
+    }
+
+    /**
+     * @brief extend the <dimension> of the worksheet that rowNode belongs to, so that it includes a new cell in column colNo
+     * @note the worksheet's <dimension> element is created (and checked against the cells) by the XLWorksheet constructor. If it
+     *  does not exist, the worksheet is not being maintained and nothing is done.
+     */
+    inline void includeInSheetDimension(XMLNode rowNode, uint16_t colNo)
+    {
+        const XMLNode sheetNode = rowNode.parent().parent();
+        XMLAttribute  ref       = sheetNode.child("dimension").attribute("ref");
+        if (ref.empty()) return;
+
+        XLSheetDimension dimension = readSheetDimension(sheetNode);
+        if (dimension.include(static_cast<uint32_t>(rowNode.attribute("r").as_ullong()), colNo)) {
+            char buffer[24];
+            ref.set_value(buffer, formatSheetDimension(dimension, buffer));
+        }
+    }
+
     /**
      * @brief set the cell reference, and a default cell style attribute if and only if row or column style is != XLDefaultCellFormat
      * @note row style takes precedence over column style
+     * @note every new cell node passes through this function, which therefore also extends the worksheet's <dimension> to the cell
      * @param cellNode the cell XML node
      * @param cellRef the cell reference (attribute r) to set
      * @param rowNode the row node for the cell
@@ -249,6 +392,7 @@ namespace OpenXLSX
 
         if (cellStyle != XLDefaultCellFormat) // if cellStyle was determined as not the default style (no point in setting that)
             cellNode.append_attribute("s").set_value(cellStyle);
+        includeInSheetDimension(rowNode, colNo);    // keep the worksheet's used range up to date
     }
 
     /**
@@ -272,26 +416,33 @@ namespace OpenXLSX
 
         XMLNode cellNode = rowNode.last_child_of_type(pugi::node_element);
         if (!rowNumber) rowNumber = rowNode.attribute("r").as_uint(); // if not provided, determine from rowNode
-        auto cellRef  = XLCellReference(rowNumber, columnNumber);
+        // ===== The address of a new cell is only built if the cell has to be created
+        auto createCell = [&](XMLNode newNode) {
+            setDefaultCellAttributes(newNode, XLCellReference(rowNumber, columnNumber).address(), rowNode, columnNumber, colStyles);
+            return newNode;
+        };
+        auto columnOf = [](XMLNode node) { return XLCellReference::columnFromAddress(node.attribute("r").value()); };
+
+        const uint16_t lastColumn = (cellNode.empty() ? 0 : columnOf(cellNode));
 
         // ===== If there are no cells in the current row, or the requested cell is beyond the last cell in the row...
-        if (cellNode.empty() || (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber)) {
+        if (cellNode.empty() || lastColumn < columnNumber) {
             // ===== append a new node to the end.
-            cellNode = rowNode.append_child("c");
-            setDefaultCellAttributes(cellNode, cellRef.address(), rowNode, columnNumber, colStyles);
+            cellNode = createCell(rowNode.append_child("c"));
         }
         // ===== If the requested node is closest to the end, start from the end and search backwards...
-        else if (XLCellReference(cellNode.attribute("r").value()).column() - columnNumber < columnNumber) {
-            while (not cellNode.empty() && (XLCellReference(cellNode.attribute("r").value()).column() > columnNumber))
+        else if (lastColumn - columnNumber < columnNumber) {
+            uint16_t column = lastColumn;
+            while (column > columnNumber) {
                 cellNode = cellNode.previous_sibling_of_type(pugi::node_element);
-            // ===== If the backwards search failed to locate the requested cell
-            if (cellNode.empty() || (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber)) {
-                if (cellNode.empty()) // If between row begin and higher column number, only non-element nodes exist
-                    cellNode = rowNode.prepend_child("c"); // insert a new cell node at row begin. When saving, this will keep whitespace formatting towards next cell node
-                else
-                    cellNode = rowNode.insert_child_after("c", cellNode);
-                setDefaultCellAttributes(cellNode, cellRef.address(), rowNode, columnNumber, colStyles);
+                if (cellNode.empty()) break;
+                column = columnOf(cellNode);
             }
+            // ===== If the backwards search failed to locate the requested cell
+            if (cellNode.empty()) // If between row begin and higher column number, only non-element nodes exist
+                cellNode = createCell(rowNode.prepend_child("c")); // insert a new cell node at row begin. When saving, this will keep whitespace formatting towards next cell node
+            else if (column < columnNumber)
+                cellNode = createCell(rowNode.insert_child_after("c", cellNode));
         }
         // ===== Otherwise, start from the beginning
         else {
@@ -299,13 +450,13 @@ namespace OpenXLSX
             cellNode = rowNode.first_child_of_type(pugi::node_element);
 
             // ===== It has been verified above that the requested columnNumber is <= the column number of the last node_element, therefore this loop will halt:
-            while (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber)
+            uint16_t column = columnOf(cellNode);
+            while (column < columnNumber) {
                 cellNode = cellNode.next_sibling_of_type(pugi::node_element);
-            // ===== If the forwards search failed to locate the requested cell
-            if (XLCellReference(cellNode.attribute("r").value()).column() > columnNumber) {
-                cellNode = rowNode.insert_child_before("c", cellNode);
-                setDefaultCellAttributes(cellNode, cellRef.address(), rowNode, columnNumber, colStyles);
+                column   = columnOf(cellNode);
             }
+            // ===== If the forwards search failed to locate the requested cell
+            if (column > columnNumber) cellNode = createCell(rowNode.insert_child_before("c", cellNode));
         }
         return cellNode;
     }
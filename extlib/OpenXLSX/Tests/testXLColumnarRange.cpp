@@ -0,0 +1,105 @@
+#include <OpenXLSX.hpp>
+#include <catch.hpp>
+
+using namespace OpenXLSX;
+
+TEST_CASE("XLColumnarRange Tests", "[XLColumnarRange]")
+{
+    XLDocument doc;
+    doc.create("./testXLColumnarRange.xlsx", XLForceOverwrite);
+    auto wks = doc.workbook().worksheet("Sheet1");
+
+    SECTION("Columns are typed by their values")
+    {
+        for (uint32_t row = 1; row <= 100; ++row) {
+            wks.cell(row, 1).value() = static_cast<int64_t>(row) * 10;
+            wks.cell(row, 2).value() = (row % 2 == 0 ? XLCellValue(row + 0.5) : XLCellValue(static_cast<int64_t>(row)));
+            wks.cell(row, 3).value() = (row % 3 == 0 ? "fizz" : "buzz");
+            if (row % 10 == 0) wks.cell(row, 4).value() = (row % 20 == 0);
+        }
+        wks.cell(50, 1).value().clear();
+
+        auto range = wks.columnarRange(XLCellReference("A1"), XLCellReference("E100"));
+        REQUIRE(range.rowCount() == 100);
+        REQUIRE(range.columnCount() == 5);
+
+        const auto& integers = range.column(0);
+        REQUIRE(integers.type == XLColumnType::Integer);
+        REQUIRE(integers.integers.size() == 100);
+        REQUIRE(integers.integers[0] == 10);
+        REQUIRE(integers.integers[99] == 1000);
+        REQUIRE(integers.isValid(48));
+        REQUIRE_FALSE(integers.isValid(49));
+        REQUIRE(integers.integers[49] == 0);
+
+        const auto& floats = range.column(1);
+        REQUIRE(floats.type == XLColumnType::Float);
+        REQUIRE(floats.integers.empty());
+        REQUIRE(floats.floats[0] == 1.0);
+        REQUIRE(floats.floats[1] == 2.5);
+        REQUIRE(floats.floats[98] == 99.0);
+
+        const auto& strings = range.column(2);
+        REQUIRE(strings.type == XLColumnType::String);
+        REQUIRE(range.stringValue(2, 0) == "buzz");
+        REQUIRE(range.stringValue(2, 2) == "fizz");
+        REQUIRE(strings.sharedStringIndices[2] == strings.sharedStringIndices[5]);
+        REQUIRE(strings.stringOffsets[2] == strings.stringOffsets[5]);
+        REQUIRE(range.stringArena().size() == 8);
+
+        const auto& booleans = range.column(3);
+        REQUIRE(booleans.type == XLColumnType::Boolean);
+        REQUIRE(booleans.integers[9] == 0);
+        REQUIRE(booleans.integers[19] == 1);
+        REQUIRE(booleans.isValid(19));
+        REQUIRE_FALSE(booleans.isValid(18));
+
+        REQUIRE(range.column(4).type == XLColumnType::Empty);
+        REQUIRE(range.column(4).integers.empty());
+        REQUIRE_THROWS_AS(range.column(5), XLInputError);
+    }
+
+    SECTION("Mixed columns are widened to strings")
+    {
+        wks.cell("B2").value() = 42;
+        wks.cell("B3").value() = true;
+        wks.cell("B4").value() = 0.25;
+        wks.cell("B5").value() = "text";
+        wks.cell("B6").value() = 7;
+        wks.cell("C2").value() = 3;
+        wks.cell("C3").value() = false;
+
+        auto range = wks.columnarRange(XLCellReference("B2"), XLCellReference("C7"));
+        REQUIRE(range.firstRow() == 2);
+        REQUIRE(range.firstColumn() == 2);
+        REQUIRE(range.column(0).type == XLColumnType::String);
+        REQUIRE(range.stringValue(0, 0) == "42");
+        REQUIRE(range.stringValue(0, 1) == "1");
+        REQUIRE(range.stringValue(0, 2) == "0.25");
+        REQUIRE(range.stringValue(0, 3) == "text");
+        REQUIRE(range.stringValue(0, 4) == "7");
+        REQUIRE(range.column(0).sharedStringIndices[0] == -1);
+        REQUIRE_FALSE(range.column(0).isValid(5));
+        REQUIRE(range.column(1).type == XLColumnType::Integer);
+        REQUIRE(range.column(1).integers[1] == 0);
+        REQUIRE(range.column(1).isValid(1));
+
+        REQUIRE_THROWS_AS(wks.columnarRange(XLCellReference("B2"), XLCellReference("A7")), XLInputError);
+    }
+
+    SECTION("Rows outside the range and missing rows are skipped")
+    {
+        wks.cell("A1").value() = 1;
+        wks.cell("A5").value() = 5;
+        wks.cell("A9").value() = 9;
+        wks.cell("A20").value() = 20;
+
+        auto range = wks.columnarRange(XLCellReference("A3"), XLCellReference("A10"));
+        REQUIRE(range.rowCount() == 8);
+        REQUIRE(range.column(0).integers[2] == 5);
+        REQUIRE(range.column(0).integers[6] == 9);
+        REQUIRE(range.column(0).validity[0] == ((uint64_t { 1 } << 2) | (uint64_t { 1 } << 6)));
+    }
+
+    doc.close();
+}
@@ -0,0 +1,81 @@
+#include <OpenXLSX.hpp>
+#include <catch.hpp>
+
+using namespace OpenXLSX;
+
+TEST_CASE("XLComments Tests", "[XLComments]")
+{
+    XLDocument doc;
+    doc.create("./testXLComments.xlsx", XLForceOverwrite);
+    auto wks = doc.workbook().worksheet("Sheet1");
+
+    SECTION("Comments are found by cell and kept in cell order")
+    {
+        auto& comments = wks.comments();
+        comments.set("C3", "third");
+        comments.set("A1", "first");
+        comments.set("B2", "second");
+        comments.set("A1", "first, updated", 1);
+        REQUIRE(comments.count() == 3);
+        REQUIRE(comments.get("A1") == "first, updated");
+        REQUIRE(comments.authorId("A1") == 1);
+        REQUIRE(comments.get("B2") == "second");
+        REQUIRE(comments.get("D4").empty());
+        REQUIRE(comments.get("invalid").empty());
+        REQUIRE(comments.get(0).ref() == "A1");
+        REQUIRE(comments.get(1).ref() == "B2");
+        REQUIRE(comments.get(2).ref() == "C3");
+        REQUIRE(comments.shape("B2").clientData().row() == 1);
+
+        REQUIRE(comments.deleteComment("B2"));
+        REQUIRE_FALSE(comments.deleteComment("B2"));
+        REQUIRE(comments.count() == 2);
+        REQUIRE(comments.get("B2").empty());
+        REQUIRE_THROWS_AS(comments.shape("B2"), XLException);
+        comments.set("B2", "second, again");
+        REQUIRE(comments.get(1).text() == "second, again");
+    }
+
+    SECTION("Comments are set in bulk")
+    {
+        auto& comments = wks.comments();
+        comments.set("A5", "existing");
+        std::vector<XLCommentEntry> entries;
+        for (uint32_t row = 1000; row >= 1; --row) entries.push_back({ "A" + std::to_string(row), "row " + std::to_string(row) });
+        entries.push_back({ "A5", "updated", 2 });
+        entries.push_back({ "A7", "first" });
+        entries.push_back({ "A7", "last" });
+        REQUIRE(comments.set(entries));
+        REQUIRE(comments.count() == 1000);
+        REQUIRE(comments.get("A5") == "updated");
+        REQUIRE(comments.authorId("A5") == 2);
+        REQUIRE(comments.get("A7") == "last");
+        REQUIRE(comments.get(0).ref() == "A1");
+        REQUIRE(comments.get(999).ref() == "A1000");
+        REQUIRE(comments.get(499).text() == "row 500");
+        REQUIRE(comments.shape("A1000").clientData().row() == 999);
+
+        REQUIRE_THROWS_AS(comments.set({ { "B1", "valid" }, { "invalid", "x" } }), XLException);
+        REQUIRE(comments.get("B1").empty());
+        REQUIRE(comments.count() == 1000);
+    }
+
+    SECTION("Comments survive saving and reopening")
+    {
+        wks.comments().set({ { "B2", "two" }, { "A1", "one" } });
+        wks.comments().set({ { "A1", "one, updated" } });
+        doc.save();
+        doc.close();
+        doc.open("./testXLComments.xlsx");
+        auto reopened = doc.workbook().worksheet("Sheet1");
+        auto& comments = reopened.comments();
+        REQUIRE(comments.count() == 2);
+        REQUIRE(comments.get("A1") == "one, updated");
+        REQUIRE(reopened.vmlDrawing().shapeCount() == 2);
+        REQUIRE(comments.get("B2") == "two");
+        comments.set("A2", "between");
+        REQUIRE(comments.get(1).ref() == "A2");
+    }
+
+    doc.close();
+}
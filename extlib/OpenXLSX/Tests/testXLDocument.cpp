@@ -28,6 +28,50 @@ TEST_CASE("XLDocument Tests", "[XLDocument]")
         REQUIRE_FALSE(doc);
     }
 
+    /**
+     * @test Look up sheets by name while sheets are added, renamed, cloned and deleted.
+     *
+     * @details Sheet, relationship and content type lookups go through indices that must follow every change.
+     */
+    SECTION("Sheet lookups after adding, renaming, cloning and deleting sheets")
+    {
+        XLDocument doc;
+        doc.create(file, XLForceOverwrite);
+        auto wbk = doc.workbook();
+
+        for (int i = 2; i <= 50; ++i) wbk.addWorksheet("Sheet" + std::to_string(i));
+        REQUIRE(wbk.sheetCount() == 50);
+        REQUIRE(wbk.worksheetExists("Sheet50"));
+        REQUIRE_THROWS_AS(wbk.addWorksheet("Sheet25"), XLInputError);
+
+        wbk.worksheet("Sheet25").cell("A1").value() = "twenty-five";
+        wbk.worksheet("Sheet25").setName("Renamed");
+        REQUIRE_FALSE(wbk.sheetExists("Sheet25"));
+        REQUIRE(wbk.worksheet("Renamed").cell("A1").value().get<std::string>() == "twenty-five");
+        REQUIRE(wbk.indexOfSheet("Renamed") == 25);
+
+        wbk.cloneSheet("Renamed", "Clone");
+        REQUIRE(wbk.worksheet("Clone").cell("A1").value().get<std::string>() == "twenty-five");
+
+        wbk.deleteSheet("Renamed");
+        REQUIRE_FALSE(wbk.sheetExists("Renamed"));
+        REQUIRE_THROWS(wbk.worksheet("Renamed"));
+        wbk.addWorksheet("Renamed");
+        REQUIRE(wbk.worksheet("Renamed").cell("A1").value().type() == XLValueType::Empty);
+        REQUIRE(wbk.sheetCount() == 51);
+
+        doc.save();
+        doc.close();
+
+        doc.open(file);
+        wbk = doc.workbook();
+        REQUIRE(wbk.sheetCount() == 51);
+        REQUIRE(wbk.worksheet("Clone").cell("A1").value().get<std::string>() == "twenty-five");
+        REQUIRE(wbk.worksheet("Sheet50").name() == "Sheet50");
+        REQUIRE_FALSE(wbk.sheetExists("Sheet25"));
+        doc.close();
+    }
+
     //    /**
     //     * @test Create new document using the CreateDocument method.
     //     *
@@ -0,0 +1,110 @@
+#include <OpenXLSX.hpp>
+#include <catch.hpp>
+
+using namespace OpenXLSX;
+
+TEST_CASE("XLMergeCells Tests", "[XLMergeCells]")
+{
+    XLDocument doc;
+    doc.create("./testXLMergeCells.xlsx", XLForceOverwrite);
+    auto wks = doc.workbook().worksheet("Sheet1");
+
+    SECTION("Merges are found by reference and by cell")
+    {
+        wks.mergeCells("B2:C3");
+        wks.mergeCells("A100:D100");
+        wks.mergeCells("E1:E1000");
+        auto& merges = wks.merges();
+        REQUIRE(merges.count() == 3);
+        REQUIRE(merges.findMerge("A100:D100") == 1);
+        REQUIRE(merges.findMerge("A100:C100") == XLMergeNotFound);
+        REQUIRE(merges.findMerge("invalid") == XLMergeNotFound);
+        REQUIRE(merges.findMergeByCell("C3") == 0);
+        REQUIRE(merges.findMergeByCell("D3") == XLMergeNotFound);
+        REQUIRE(merges.findMergeByCell("C100") == 1);
+        REQUIRE(merges.findMergeByCell("E500") == 2);
+        REQUIRE(merges.findMergeByCell("E1001") == XLMergeNotFound);
+
+        REQUIRE_THROWS_AS(wks.mergeCells("C3:D4"), XLInputError);
+        REQUIRE_THROWS_AS(wks.mergeCells("D999:F999"), XLInputError);
+        REQUIRE_THROWS_AS(merges.appendMerge("D4:D4"), XLInputError);
+        REQUIRE_THROWS_AS(merges.appendMerge("D5:C4"), XLInputError);
+        REQUIRE(merges.count() == 3);
+    }
+
+    SECTION("Deleting a merge renumbers the merges that follow it")
+    {
+        auto& merges = wks.merges();
+        for (uint32_t row = 1; row <= 200; ++row) merges.appendMerge("A" + std::to_string(row) + ":C" + std::to_string(row));
+        merges.deleteMerge(merges.findMerge("A50:C50"));
+        REQUIRE(merges.count() == 199);
+        REQUIRE(merges.findMergeByCell("B50") == XLMergeNotFound);
+        REQUIRE(merges.findMergeByCell("B51") == 49);
+        REQUIRE(std::string(merges.merge(49)) == "A51:C51");
+        REQUIRE(merges.appendMerge("A50:B50") == 199);
+        REQUIRE(merges.findMergeByCell("B50") == 199);
+    }
+
+    SECTION("A batch of merges is appended entirely or not at all")
+    {
+        auto& merges = wks.merges();
+        merges.appendMerge("A1:B1");
+        REQUIRE(merges.appendMerges({ "C1:D1", "E1:F2", "A3:F3" }) == 1);
+        REQUIRE(merges.count() == 4);
+        REQUIRE(merges.findMergeByCell("F2") == 2);
+
+        REQUIRE_THROWS_AS(merges.appendMerges({ "A4:B4", "B1:B5" }), XLInputError);
+        REQUIRE_THROWS_AS(merges.appendMerges({ "A4:B4", "A5:C5", "B5:B6" }), XLInputError);
+        REQUIRE(merges.count() == 4);
+        REQUIRE(merges.findMergeByCell("A4") == XLMergeNotFound);
+        REQUIRE(merges.appendMerge("A4:B5") == 4);
+    }
+
+    SECTION("Merges are read back from the worksheet")
+    {
+        wks.merges().appendMerges({ "A1:B2", "C10:D20" });
+        doc.save();
+        doc.close();
+        doc.open("./testXLMergeCells.xlsx");
+        auto  reopened = doc.workbook().worksheet("Sheet1");
+        auto& merges   = reopened.merges();
+        REQUIRE(merges.count() == 2);
+        REQUIRE(merges.findMergeByCell("D15") == 1);
+        REQUIRE_THROWS_AS(merges.appendMerge("B2:C10"), XLInputError);
+    }
+
+    SECTION("Merges with an unparseable reference are kept in the document")
+    {
+        wks.merges().appendMerges({ "A1:B2", "C10:D20" });
+        doc.save();
+        doc.close();
+        {
+            XLZipArchive archive;
+            archive.open("./testXLMergeCells.xlsx");
+            std::string xml = archive.getEntry("xl/worksheets/sheet1.xml");
+            const std::string valid = "<mergeCell ref=\"C10:D20\"/>";
+            REQUIRE(xml.find(valid) != std::string::npos);
+            xml.replace(xml.find(valid), valid.size(), "<mergeCell ref=\"bogus\"/>" + valid);
+            archive.addEntry("xl/worksheets/sheet1.xml", xml);
+            archive.save();
+            archive.close();
+        }
+
+        doc.open("./testXLMergeCells.xlsx");
+        auto  reopened = doc.workbook().worksheet("Sheet1");
+        auto& merges   = reopened.merges();
+        REQUIRE(merges.count() == 3);
+        REQUIRE(std::string(merges.merge(1)) == "bogus");
+        REQUIRE(merges.findMergeByCell("D15") == 2);
+        REQUIRE(merges.findMergeByCell("B2") == 0);
+
+        merges.deleteMerge(0);
+        REQUIRE(std::string(merges.merge(0)) == "bogus");
+        REQUIRE(merges.findMergeByCell("D15") == 1);
+        doc.save();
+        doc.close();
+
+        doc.open("./testXLMergeCells.xlsx");
+        REQUIRE(doc.workbook().worksheet("Sheet1").merges().count() == 2);
+    }
+}
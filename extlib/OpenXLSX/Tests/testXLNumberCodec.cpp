@@ -0,0 +1,92 @@
+#include <OpenXLSX.hpp>
+#include <catch.hpp>
+#include <limits>
+#include <string>
+
+using namespace OpenXLSX;
+
+namespace
+{
+    std::string formatted(int64_t value)
+    {
+        char buffer[XLNumberBufferSize];
+        return std::string(buffer, formatInteger(value, buffer));
+    }
+
+    bool parsed(const std::string& text, int64_t& value) { return parseInteger(text.data(), text.data() + text.size(), value); }
+}    // namespace
+
+TEST_CASE("XLNumberCodec Tests", "[XLNumberCodec]")
+{
+    SECTION("Integers")
+    {
+        int64_t value = 0;
+        REQUIRE(formatted(0) == "0");
+        REQUIRE(formatted(-42) == "-42");
+        REQUIRE(formatted(std::numeric_limits<int64_t>::min()) == "-9223372036854775808");
+
+        REQUIRE(parsed("0", value));
+        REQUIRE(value == 0);
+        REQUIRE(parsed("12345678", value));
+        REQUIRE(value == 12345678);
+        REQUIRE(parsed("-1234567890123", value));
+        REQUIRE(value == -1234567890123);
+        REQUIRE(parsed("9223372036854775807", value));
+        REQUIRE(value == std::numeric_limits<int64_t>::max());
+        REQUIRE(parsed("-9223372036854775808", value));
+        REQUIRE(value == std::numeric_limits<int64_t>::min());
+        REQUIRE(parsed("00000000000000000000042", value));
+        REQUIRE(value == 42);
+
+        REQUIRE_FALSE(parsed("", value));
+        REQUIRE_FALSE(parsed("-", value));
+        REQUIRE_FALSE(parsed("9223372036854775808", value));
+        REQUIRE_FALSE(parsed("9999999999999999999", value));
+        REQUIRE_FALSE(parsed("1234567a", value));
+        REQUIRE_FALSE(parsed("123456789/", value));
+        REQUIRE_FALSE(parsed("1.5", value));
+
+        REQUIRE(textToInteger("  17") == 17);
+        REQUIRE(textToInteger("17abc") == 17);
+    }
+
+    SECTION("Floats")
+    {
+        double value = 0;
+        REQUIRE(formatFloat(0.1) == "0.1");
+        REQUIRE(formatFloat(-2.5) == "-2.5");
+        REQUIRE(formatFloat(100.0) == "100");
+        REQUIRE(formatFloat(1e-7) == "1e-07");
+        REQUIRE(formatFloat(1e16) == "1e+16");
+
+        for (double number : { 0.1, 1.0 / 3.0, -123456.789, 6.02214076e23, 5e-324, std::numeric_limits<double>::max() }) {
+            const std::string text = formatFloat(number);
+            REQUIRE(parseFloat(text.data(), text.data() + text.size(), value));
+            REQUIRE(value == number);
+        }
+
+        const std::string exponent = "1E+16";
+        REQUIRE(isFloatText(exponent.data(), exponent.data() + exponent.size()));
+        REQUIRE(textToFloat("1E+16") == 1e16);
+        REQUIRE(textToFloat(" 2.5") == 2.5);
+    }
+
+    SECTION("Cell values")
+    {
+        XLDocument doc;
+        doc.create("./testXLNumberCodec.xlsx", XLForceOverwrite);
+        auto wks = doc.workbook().worksheet("Sheet1");
+
+        wks.cell("A1").value() = 0.1;
+        wks.cell("A2").value() = 1e16;
+        wks.cell("A3").value() = int64_t { -1234567890123 };
+        REQUIRE(wks.cell("A1").value().type() == XLValueType::Float);
+        REQUIRE(wks.cell("A1").value().get<double>() == 0.1);
+        REQUIRE(wks.cell("A1").value().getString() == "0.100000");    // the string conversion keeps the std::to_string form
+        REQUIRE(wks.cell("A2").value().type() == XLValueType::Float);
+        REQUIRE(wks.cell("A2").value().get<double>() == 1e16);
+        REQUIRE(wks.cell("A3").value().get<int64_t>() == -1234567890123);
+
+        doc.close();
+    }
+}
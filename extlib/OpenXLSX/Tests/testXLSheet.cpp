@@ -74,4 +74,57 @@ TEST_CASE("XLSheet Tests", "[XLSheet]")
 
         doc.save();
     }
+
+    SECTION("XLWorksheet Used Range") {
+        XLDocument doc;
+        doc.create("./testXLSheet3.xlsx", XLForceOverwrite);
+        auto wks = doc.workbook().worksheet("Sheet1");
+        REQUIRE(wks.columnCount() == 0);
+        REQUIRE(wks.usedRange().address() == "A1:A1");
+        REQUIRE(doc.workbook().streamWorksheet("Sheet1").dimension() == "A1");
+
+        wks.cell("C5").value() = 1;
+        REQUIRE(wks.usedRange().address() == "C5:C5");
+        REQUIRE(doc.workbook().streamWorksheet("Sheet1").dimension() == "C5");    // a single cell is stored as Excel does
+        wks.row(10).values() = std::vector<int> { 1, 2, 3, 4 };
+        REQUIRE(wks.usedRange().address() == "A5:D10");
+        REQUIRE(doc.workbook().streamWorksheet("Sheet1").dimension() == "A5:D10");
+        for (auto& cell : wks.range(XLCellReference("E2"), XLCellReference("F3"))) cell.value() = 1;
+        REQUIRE(wks.usedRange().address() == "A2:F10");
+        REQUIRE(wks.columnCount() == 6);
+
+        wks.row(20);    // a row without cells does not extend the used range
+        REQUIRE(wks.usedRange().address() == "A2:F10");
+
+        REQUIRE(wks.deleteRow(10));
+        REQUIRE(wks.usedRange().address() == "C2:F5");
+        REQUIRE(wks.deleteRow(2));
+        REQUIRE(wks.deleteRow(3));
+        REQUIRE(wks.usedRange().address() == "C5:C5");
+        REQUIRE(wks.deleteRow(5));
+        REQUIRE(wks.columnCount() == 0);
+
+        // ===== "A1" is stored for the cell A1 as well as for a worksheet without cells
+        wks.cell("A1").value() = 1;
+        REQUIRE(wks.columnCount() == 1);
+        REQUIRE(wks.usedRange().address() == "A1:A1");
+        wks.cell("B2").value() = 1;
+        REQUIRE(doc.workbook().streamWorksheet("Sheet1").dimension() == "A1:B2");
+        REQUIRE(wks.deleteRow(2));
+        REQUIRE(doc.workbook().streamWorksheet("Sheet1").dimension() == "A1");
+        REQUIRE(wks.columnCount() == 1);
+        REQUIRE(wks.deleteRow(1));
+        REQUIRE(wks.columnCount() == 0);
+        wks.cell("B3").value() = 1;
+        REQUIRE(wks.usedRange().address() == "B3:B3");
+        REQUIRE(wks.deleteRow(3));
+
+        wks.cell("AA100").value() = 1;
+        doc.save();
+        doc.close();
+
+        doc.open("./testXLSheet3.xlsx");
+        REQUIRE(doc.workbook().worksheet("Sheet1").usedRange().address() == "AA100:AA100");
+        doc.close();
+    }
 }
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include <OpenXLSX.hpp>
+#include <catch.hpp>
+
+using namespace OpenXLSX;
+
+TEST_CASE("XLStreamReader Tests", "[XLStreamReader]")
+{
+    {
+        XLDocument doc;
+        doc.create("./testXLStreamReader.xlsx", XLForceOverwrite);
+        auto wks = doc.workbook().worksheet("Sheet1");
+        wks.cell("A1").value() = "Shared & <string>";
+        wks.cell("B1").value() = 42;
+        wks.cell("C1").value() = 3.25;
+        wks.cell("D1").value() = true;
+        wks.cell("C3").value() = "Shared & <string>";
+        wks.cell("A4").value().setError("#N/A");
+        for (uint32_t row = 10; row <= 1000; ++row) wks.cell(row, 1).value() = row;
+        doc.workbook().addWorksheet("Empty");
+        doc.save();
+    }
+
+    SECTION("Rows and values match the worksheet")
+    {
+        XLDocument doc;
+        doc.open("./testXLStreamReader.xlsx");
+        auto reader = doc.workbook().streamWorksheet("Sheet1");
+        REQUIRE(reader.rowNumber() == 0);
+        REQUIRE(reader.dimension() == "A1:D1000");
+
+        REQUIRE(reader.nextRow());
+        REQUIRE(reader.rowNumber() == 1);
+        REQUIRE(reader.values().size() == 4);
+        REQUIRE(reader.values()[0].get<std::string>() == "Shared & <string>");
+        REQUIRE(reader.values()[1].get<int64_t>() == 42);
+        REQUIRE(reader.values()[2].get<double>() == 3.25);
+        REQUIRE(reader.values()[3].get<bool>() == true);
+
+        REQUIRE(reader.nextRow());
+        REQUIRE(reader.rowNumber() == 3);
+        REQUIRE(reader.values().size() == 3);
+        REQUIRE(reader.values()[0].type() == XLValueType::Empty);
+        REQUIRE(reader.values()[2].get<std::string>() == "Shared & <string>");
+
+        REQUIRE(reader.nextRow());
+        REQUIRE(reader.rowNumber() == 4);
+        REQUIRE(reader.values()[0].type() == XLValueType::Error);
+
+        uint32_t expected = 10;
+        while (reader.nextRow()) {
+            REQUIRE(reader.rowNumber() == expected);
+            REQUIRE(reader.values()[0].get<uint32_t>() == expected);
+            ++expected;
+        }
+        REQUIRE(expected == 1001);
+        REQUIRE_FALSE(reader.nextRow());
+
+        REQUIRE(reader.dimension() == "A1:D1000");
+
+        REQUIRE_FALSE(doc.workbook().streamWorksheet("Empty").nextRow());
+        REQUIRE(doc.workbook().streamWorksheet("Empty").dimension() == "A1");
+        REQUIRE_THROWS_AS(doc.workbook().streamWorksheet("Missing"), XLInputError);
+    }
+
+    SECTION("Changes that are not saved yet are visible")
+    {
+        XLDocument doc;
+        doc.open("./testXLStreamReader.xlsx");
+        doc.workbook().worksheet("Sheet1").cell("B2").value() = "Changed";
+
+        auto reader = doc.workbook().streamWorksheet("Sheet1");
+        REQUIRE(reader.nextRow());
+        REQUIRE(reader.nextRow());
+        REQUIRE(reader.rowNumber() == 2);
+        REQUIRE(reader.values()[1].get<std::string>() == "Changed");
+    }
+
+    SECTION("Modified archive entries are streamed from memory, even if empty")
+    {
+        XLZipArchive archive;
+        archive.open("./testXLStreamReader.xlsx");
+        archive.addEntry("xl/worksheets/sheet1.xml", "");
+        archive.addEntry("xl/new.xml", "");
+        archive.addEntry("xl/other.xml", "<other/>");
+
+        char buffer[64];
+        REQUIRE(archive.openEntryStream("xl/worksheets/sheet1.xml")(buffer, sizeof(buffer)) == 0);
+        REQUIRE(archive.openEntryStream("xl/new.xml")(buffer, sizeof(buffer)) == 0);
+
+        auto stream = archive.openEntryStream("xl/other.xml");
+        REQUIRE(stream(buffer, sizeof(buffer)) == 8);
+        REQUIRE(std::string(buffer, 8) == "<other/>");
+        REQUIRE(stream(buffer, sizeof(buffer)) == 0);
+        archive.close();
+    }
+}
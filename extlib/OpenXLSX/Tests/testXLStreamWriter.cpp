@@ -0,0 +1,75 @@
+#include <OpenXLSX.hpp>
+#include <catch.hpp>
+#include <cmath>
+
+using namespace OpenXLSX;
+
+TEST_CASE("XLStreamWriter Tests", "[XLStreamWriter]")
+{
+    {
+        XLDocument doc;
+        doc.create("./testXLStreamWriter.xlsx", XLForceOverwrite);
+        auto wks = doc.workbook().worksheet("Sheet1");
+        wks.cell("A1").value() = "Replaced";
+        wks.cell("A5").value() = "Replaced";
+        wks.column(2).setWidth(20);
+        doc.save();
+    }
+
+    SECTION("Written rows replace the rows of the worksheet")
+    {
+        {
+            XLDocument doc;
+            doc.open("./testXLStreamWriter.xlsx");
+            auto writer = doc.workbook().worksheetWriter("Sheet1");
+            writer.appendRow({ XLCellValue("Shared & <string>"), XLCellValue(42), XLCellValue(3.25), XLCellValue(true) });
+            writer.appendRow(3, { XLCellValue("Shared & <string>"), XLCellValue(), XLCellValue(std::nan("1")) }, 2);
+            for (uint32_t row = 10; row <= 10000; ++row) writer.appendRow(row, { XLCellValue(row), XLCellValue("Row " + std::to_string(row % 10)) });
+            REQUIRE(writer.rowNumber() == 10000);
+            REQUIRE_THROWS_AS(writer.appendRow(10000, { XLCellValue(1) }), XLInputError);
+            writer.close();
+            REQUIRE_THROWS_AS(writer.appendRow({ XLCellValue(1) }), XLInputError);
+
+            auto wks = doc.workbook().worksheet("Sheet1");
+            REQUIRE(wks.cell("A1").value().get<std::string>() == "Shared & <string>");
+            REQUIRE(wks.cell("B3").value().get<std::string>() == "Shared & <string>");
+            REQUIRE(wks.cell("A5").value().type() == XLValueType::Empty);
+            doc.save();
+        }
+
+        XLDocument doc;
+        doc.open("./testXLStreamWriter.xlsx");
+        auto wks = doc.workbook().worksheet("Sheet1");
+        REQUIRE(wks.cell("A1").value().get<std::string>() == "Shared & <string>");
+        REQUIRE(wks.cell("B1").value().get<int64_t>() == 42);
+        REQUIRE(wks.cell("C1").value().get<double>() == 3.25);
+        REQUIRE(wks.cell("D1").value().get<bool>() == true);
+        REQUIRE(wks.cell("B3").value().get<std::string>() == "Shared & <string>");
+        REQUIRE(wks.cell("C3").value().type() == XLValueType::Empty);
+        REQUIRE(wks.cell("D3").value().type() == XLValueType::Error);
+        REQUIRE(wks.cell("A5").value().type() == XLValueType::Empty);
+        REQUIRE(wks.cell("A10000").value().get<uint32_t>() == 10000);
+        REQUIRE(wks.cell("B9999").value().get<std::string>() == "Row 9");
+        REQUIRE(wks.column(2).width() == 20);
+        REQUIRE(wks.rowCount() == 10000);
+    }
+
+    SECTION("A writer that is not closed explicitly is closed when destroyed")
+    {
+        {
+            XLDocument doc;
+            doc.open("./testXLStreamWriter.xlsx");
+            doc.workbook().addWorksheet("Export");
+            doc.workbook().worksheetWriter("Export").appendRow({ XLCellValue("Exported") });
+            doc.save();
+        }
+
+        XLDocument doc;
+        doc.open("./testXLStreamWriter.xlsx");
+        auto reader = doc.workbook().streamWorksheet("Export");
+        REQUIRE(reader.nextRow());
+        REQUIRE(reader.values()[0].get<std::string>() == "Exported");
+        REQUIRE_FALSE(reader.nextRow());
+        REQUIRE_THROWS_AS(doc.workbook().worksheetWriter("Missing"), XLInputError);
+    }
+}
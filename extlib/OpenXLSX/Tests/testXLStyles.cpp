@@ -0,0 +1,111 @@
+#include <OpenXLSX.hpp>
+#include <catch.hpp>
+
+using namespace OpenXLSX;
+
+TEST_CASE("XLStyles Tests", "[XLStyles]")
+{
+    XLDocument doc;
+    doc.create("./testXLStyles.xlsx", XLForceOverwrite);
+    XLStyles& styles = doc.styles();
+
+    SECTION("An identical entry reuses the index of the existing one")
+    {
+        const size_t fontCount   = styles.fonts().count();
+        const size_t fillCount   = styles.fills().count();
+        const size_t formatCount = styles.cellFormats().count();
+
+        REQUIRE(styles.fonts().intern(styles.fonts().create(styles.fonts()[0])) == 0);
+        REQUIRE(styles.fills().intern(styles.fills().create(styles.fills()[0])) == 0);
+        REQUIRE(styles.cellFormats().intern(styles.cellFormats().create(styles.cellFormats()[0])) == 0);
+
+        // ===== The copies were the last entries, so they are removed again
+        REQUIRE(styles.fonts().count() == fontCount);
+        REQUIRE(styles.fills().count() == fillCount);
+        REQUIRE(styles.cellFormats().count() == formatCount);
+    }
+
+    SECTION("A different entry gets a new index, which is reused for the same content")
+    {
+        const size_t fontCount = styles.fonts().count();
+
+        const XLStyleIndex bold = styles.fonts().create(styles.fonts()[0]);
+        styles.fonts()[bold].setBold(true);
+        REQUIRE(styles.fonts().intern(bold) == bold);
+        REQUIRE(bold == fontCount);
+        REQUIRE(styles.fonts().count() == fontCount + 1);
+        REQUIRE(styles.fonts()[bold].bold());
+        REQUIRE_FALSE(styles.fonts()[0].bold());
+
+        const XLStyleIndex boldAgain = styles.fonts().create(styles.fonts()[0]);
+        styles.fonts()[boldAgain].setBold(true);
+        REQUIRE(styles.fonts().intern(boldAgain) == bold);
+        REQUIRE(styles.fonts().count() == fontCount + 1);
+
+        const XLStyleIndex italic = styles.fonts().create(styles.fonts()[0]);
+        styles.fonts()[italic].setItalic(true);
+        REQUIRE(styles.fonts().intern(italic) == fontCount + 1);
+        REQUIRE(styles.fonts().count() == fontCount + 2);
+
+        const size_t       formatCount = styles.cellFormats().count();
+        const XLStyleIndex boldFormat  = styles.cellFormats().create(styles.cellFormats()[0]);
+        styles.cellFormats()[boldFormat].setFontIndex(bold);
+        REQUIRE(styles.cellFormats().intern(boldFormat) == formatCount);
+        REQUIRE(styles.cellFormats()[formatCount].fontIndex() == bold);
+
+        const XLStyleIndex boldFormatAgain = styles.cellFormats().create(styles.cellFormats()[0]);
+        styles.cellFormats()[boldFormatAgain].setFontIndex(bold);
+        REQUIRE(styles.cellFormats().intern(boldFormatAgain) == formatCount);
+        REQUIRE(styles.cellFormats().count() == formatCount + 1);
+    }
+
+    SECTION("Interning per cell across a block stores one entry per distinct style")
+    {
+        auto wks = doc.workbook().worksheet("Sheet1");
+
+        const size_t fontCount   = styles.fonts().count();
+        const size_t fillCount   = styles.fills().count();
+        const size_t formatCount = styles.cellFormats().count();
+
+        // ===== Every cell of B2:D4 gets its own bold font, yellow fill and cell format, which are interned right away; C3 is
+        //       also made italic
+        for (auto& cell : wks.range(XLCellReference("B2"), XLCellReference("D4"))) {
+            const XLStyleIndex font = styles.fonts().create(styles.fonts()[0]);
+            styles.fonts()[font].setBold(true);
+            if (cell.cellReference().address() == "C3") styles.fonts()[font].setItalic(true);
+
+            const XLStyleIndex fill = styles.fills().create(styles.fills()[0]);
+            styles.fills()[fill].setBackgroundColor(XLColor("FFFFFF00"));
+
+            const XLStyleIndex format = styles.cellFormats().create(styles.cellFormats()[cell.cellFormat()]);
+            styles.cellFormats()[format].setFontIndex(styles.fonts().intern(font));
+            styles.cellFormats()[format].setFillIndex(styles.fills().intern(fill));
+            cell.setCellFormat(styles.cellFormats().intern(format));
+        }
+
+        const XLStyleIndex plain = wks.cell("B2").cellFormat();
+        REQUIRE(plain == formatCount);
+        for (auto& cell : wks.range(XLCellReference("B2"), XLCellReference("D4"))) {
+            if (cell.cellReference().address() == "C3") continue;
+            REQUIRE(cell.cellFormat() == plain);
+        }
+        REQUIRE(wks.cell("C3").cellFormat() == formatCount + 1);
+        REQUIRE(wks.cell("A1").cellFormat() == XLDefaultCellFormat);
+        REQUIRE(wks.cell("E5").cellFormat() == XLDefaultCellFormat);
+
+        // ===== Nine cells, but only a bold and a bold italic font, one fill, and a cell format for each font
+        REQUIRE(styles.fonts().count() == fontCount + 2);
+        REQUIRE(styles.fills().count() == fillCount + 1);
+        REQUIRE(styles.cellFormats().count() == formatCount + 2);
+        REQUIRE(styles.fonts()[styles.cellFormats()[plain].fontIndex()].bold());
+        REQUIRE_FALSE(styles.fonts()[styles.cellFormats()[plain].fontIndex()].italic());
+        REQUIRE(styles.fonts()[styles.cellFormats()[wks.cell("C3").cellFormat()].fontIndex()].italic());
+
+        doc.save();
+        doc.close();
+        doc.open("./testXLStyles.xlsx");
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("D4").cellFormat() == plain);
+        REQUIRE(doc.styles().cellFormats().count() == formatCount + 2);
+        doc.close();
+    }
+}
@@ -0,0 +1,116 @@
+/**
+ * @file load_test_example.cpp
+ * @brief Load test for the MCP server
+ *
+ * This example starts an MCP server in-process, opens N concurrent SSE sessions and sends M tool
+ * calls over each of them, then reports throughput and the p50/p99 latency of the tool calls.
+ *
+ * Usage: load_test_example [sessions] [requests_per_session] [port]
+ */
+
+#include "mcp_server.h"
+#include "mcp_sse_client.h"
+#include "mcp_tool.h"
+
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <algorithm>
+
+// Echo tool handler
+mcp::json echo_handler(const mcp::json& params, const std::string& /* session_id */) {
+    return {
+        {
+            {"type", "text"},
+            {"text", params.value("text", "")}
+        }
+    };
+}
+
+// Latency at the given percentile of a sorted list of samples
+double percentile(const std::vector<double>& sorted_samples, double p) {
+    if (sorted_samples.empty()) {
+        return 0.0;
+    }
+    size_t index = static_cast<size_t>(p / 100.0 * (sorted_samples.size() - 1) + 0.5);
+    return sorted_samples[std::min(index, sorted_samples.size() - 1)];
+}
+
+int main(int argc, char** argv) {
+    int sessions = argc > 1 ? std::stoi(argv[1]) : 4;
+    int requests = argc > 2 ? std::stoi(argv[2]) : 100;
+    int port = argc > 3 ? std::stoi(argv[3]) : 8889;
+
+    mcp::set_log_level(mcp::log_level::error);
+
+    // Create and start server
+    mcp::server server("localhost", port);
+    server.set_server_info("LoadTestServer", "1.0.0");
+    server.set_capabilities({{"tools", mcp::json::object()}});
+
+    mcp::tool echo_tool = mcp::tool_builder("echo")
+        .with_description("Echo input")
+        .with_string_param("text", "Text to echo")
+        .build();
+    server.register_tool(echo_tool, echo_handler);
+    server.start(false);  // Non-blocking mode
+
+    std::mutex samples_mutex;
+    std::vector<double> samples;  // Tool call latencies in milliseconds
+    std::atomic<int> failures{0};
+
+    // Run the sessions
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> clients;
+    for (int s = 0; s < sessions; ++s) {
+        clients.emplace_back([&, s]() {
+            mcp::sse_client client("localhost", port);
+            client.set_timeout(30);
+            if (!client.initialize("LoadTestClient", "1.0.0")) {
+                failures += requests;
+                return;
+            }
+
+            std::vector<double> local_samples;
+            local_samples.reserve(requests);
+            for (int r = 0; r < requests; ++r) {
+                std::string text = "session " + std::to_string(s) + " request " + std::to_string(r);
+                auto begin = std::chrono::steady_clock::now();
+                try {
+                    mcp::json result = client.call_tool("echo", {{"text", text}});
+                    if (result["content"][0]["text"] != text) {
+                        ++failures;
+                        continue;
+                    }
+                } catch (const std::exception&) {
+                    ++failures;
+                    continue;
+                }
+                auto end = std::chrono::steady_clock::now();
+                local_samples.push_back(std::chrono::duration<double, std::milli>(end - begin).count());
+            }
+
+            std::lock_guard<std::mutex> lock(samples_mutex);
+            samples.insert(samples.end(), local_samples.begin(), local_samples.end());
+        });
+    }
+    for (auto& client : clients) {
+        client.join();
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    server.stop();
+
+    // Report
+    std::sort(samples.begin(), samples.end());
+    std::cout << "Sessions: " << sessions << ", requests per session: " << requests << std::endl;
+    std::cout << "Completed: " << samples.size() << ", failed: " << failures.load() << std::endl;
+    std::cout << "Throughput: " << samples.size() / elapsed << " requests/s" << std::endl;
+    std::cout << "Latency p50: " << percentile(samples, 50) << " ms, p99: " << percentile(samples, 99) << " ms" << std::endl;
+
+    return failures.load() == 0 ? 0 : 1;
+}
@@ -6,12 +6,12 @@
 #ifndef MCP_LOGGER_H
 #define MCP_LOGGER_H
 
-#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
 #include <sstream>
 #include <string>
-#include <mutex>
-#include <chrono>
-#include <iomanip>
 
 namespace mcp {
 
@@ -22,6 +22,13 @@ enum class log_level {
     error
 };
 
+/**
+ * @brief Receives the log messages that pass the level instead of stderr
+ *
+ * The message is the concatenated arguments only; timestamp and level are left to the sink.
+ */
+using log_sink = void (*)(log_level level, const std::string& message);
+
 class logger {
 public:
     static logger& instance() {
@@ -30,8 +37,16 @@ public:
     }
     
     void set_level(log_level level) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        level_ = level;
+        level_.store(level, std::memory_order_relaxed);
+    }
+
+    bool should_log(log_level level) const {
+        return level >= level_.load(std::memory_order_relaxed);
+    }
+
+    // Routes messages to sink, or back to stderr if sink is nullptr
+    void set_sink(log_sink sink) {
+        sink_.store(sink, std::memory_order_release);
     }
     
     template<typename... Args>
@@ -55,71 +70,84 @@ public:
     }
     
 private:
-    logger() : level_(log_level::info) {}
-    
-    template<typename T>
-    void log_impl(std::stringstream& ss, T&& arg) {
-        ss << std::forward<T>(arg);
-    }
-    
-    template<typename T, typename... Args>
-    void log_impl(std::stringstream& ss, T&& arg, Args&&... args) {
-        ss << std::forward<T>(arg);
-        log_impl(ss, std::forward<Args>(args)...);
-    }
+    logger() : level_(log_level::info), sink_(nullptr) {}
     
     template<typename... Args>
     void log(log_level level, Args&&... args) {
-        if (level < level_) {
+        // Nothing is formatted for messages below the level
+        if (!should_log(level)) {
             return;
         }
         
-        std::stringstream ss;
-        
-        // Add timestamp
-        auto now = std::chrono::system_clock::now();
-        auto now_c = std::chrono::system_clock::to_time_t(now);
-        auto now_tm = std::localtime(&now_c);
-        
-        ss << std::put_time(now_tm, "%Y-%m-%d %H:%M:%S") << " ";
-        
+        std::ostringstream ss;
+        (ss << ... << std::forward<Args>(args));
+
+        if (log_sink sink = sink_.load(std::memory_order_acquire)) {
+            sink(level, ss.str());
+            return;
+        }
+        write(level, ss.str());
+    }
+
+    // Writes one line to stderr. A single fwrite is atomic with respect to other threads, so no lock is needed.
+    static void write(log_level level, const std::string& message) {
+        std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+        std::tm now_tm{};
+#ifdef _WIN32
+        localtime_s(&now_tm, &now);
+#else
+        localtime_r(&now, &now_tm);
+#endif
+        char timestamp[32];
+        size_t timestamp_length = std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S ", &now_tm);
+
         // Add log level and color
+        const char* tag = "";
         switch (level) {
             case log_level::debug:
-                ss << "\033[36m[DEBUG]\033[0m ";  // Cyan
+                tag = "\033[36m[DEBUG]\033[0m ";  // Cyan
                 break;
             case log_level::info:
-                ss << "\033[32m[INFO]\033[0m ";   // Green
+                tag = "\033[32m[INFO]\033[0m ";   // Green
                 break;
             case log_level::warning:
-                ss << "\033[33m[WARNING]\033[0m "; // Yellow
+                tag = "\033[33m[WARNING]\033[0m "; // Yellow
                 break;
             case log_level::error:
-                ss << "\033[31m[ERROR]\033[0m ";   // Red
+                tag = "\033[31m[ERROR]\033[0m ";   // Red
                 break;
         }
-        
-        // Add log content
-        log_impl(ss, std::forward<Args>(args)...);
-        
-        // Output log
-        std::lock_guard<std::mutex> lock(mutex_);
-        std::cerr << ss.str() << std::endl;
+
+        std::string line(timestamp, timestamp_length);
+        line += tag;
+        line += message;
+        line += '\n';
+        std::fwrite(line.data(), 1, line.size(), stderr);
     }
     
-    log_level level_;
-    std::mutex mutex_;
+    std::atomic<log_level> level_;
+    std::atomic<log_sink> sink_;
 };
 
-#define LOG_DEBUG(...) mcp::logger::instance().debug(__VA_ARGS__)
-#define LOG_INFO(...) mcp::logger::instance().info(__VA_ARGS__)
-#define LOG_WARNING(...) mcp::logger::instance().warning(__VA_ARGS__)
-#define LOG_ERROR(...) mcp::logger::instance().error(__VA_ARGS__)
+// The arguments are only evaluated if the level is enabled
+#define MCP_LOG_AT(level, method, ...) \
+    do { \
+        if (mcp::logger::instance().should_log(level)) mcp::logger::instance().method(__VA_ARGS__); \
+    } while (0)
+
+#define LOG_DEBUG(...) MCP_LOG_AT(mcp::log_level::debug, debug, __VA_ARGS__)
+#define LOG_INFO(...) MCP_LOG_AT(mcp::log_level::info, info, __VA_ARGS__)
+#define LOG_WARNING(...) MCP_LOG_AT(mcp::log_level::warning, warning, __VA_ARGS__)
+#define LOG_ERROR(...) MCP_LOG_AT(mcp::log_level::error, error, __VA_ARGS__)
 
 inline void set_log_level(log_level level) {
     mcp::logger::instance().set_level(level);
 }
 
+inline void set_log_sink(log_sink sink) {
+    mcp::logger::instance().set_sink(sink);
+}
+
 } // namespace mcp
 
 #endif // MCP_LOGGER_H 
\ No newline at end of file
@@ -19,7 +19,9 @@
 #include "httplib.h"
 
 #include <string>
+#include <iostream>
 #include <map>
+#include <deque>
 #include <vector>
 #include <memory>
 #include <mutex>
@@ -29,6 +31,8 @@
 #include <condition_variable>
 #include <future>
 #include <atomic>
+#include <algorithm>
+#include <cstdint>
 
 
 namespace mcp {
@@ -39,10 +43,29 @@ using notification_handler = std::function<void(const json&, const std::string&)
 using auth_handler = std::function<bool(const std::string&, const std::string&)>;
 using session_cleanup_handler = std::function<void(const std::string&)>;
 
+/**
+ * @brief Counters describing the event queue of one SSE session
+ */
+struct event_dispatcher_stats {
+    size_t queue_depth = 0;      // Events currently waiting to be written
+    size_t max_queue_depth = 0;  // Highest queue depth seen so far
+    uint64_t enqueued = 0;       // Events accepted by send_event
+    uint64_t dropped = 0;        // Events rejected because the queue stayed full
+    uint64_t writes = 0;         // Calls to sink->write, each carrying one or more events
+};
+
+/**
+ * @brief Bounded queue of SSE events for one session
+ *
+ * Producers (tool responses, notifications, heartbeats) append complete SSE events with send_event;
+ * the connection's content provider drains them with wait_event, which writes all pending events
+ * in a single sink->write. When the queue is full, send_event waits up to max_wait for the consumer
+ * to make room and then rejects the event, so a stalled client applies backpressure instead of
+ * growing the queue without limit. No accepted event is ever overwritten or dropped.
+ */
 class event_dispatcher {
 public:
-    event_dispatcher() {
-        message_.reserve(128); // Pre-allocate space for messages
+    explicit event_dispatcher(size_t max_queued = 1024) : max_queued_(max_queued > 0 ? max_queued : 1) {
     }
     
     ~event_dispatcher() {
@@ -54,42 +77,32 @@ public:
             return false;
         }
         
-        std::string message_copy;
         {
             std::unique_lock<std::mutex> lk(m_);
             
-            if (closed_.load(std::memory_order_acquire)) {
-                return false;
-            }
-            
-            int id = id_.load(std::memory_order_relaxed);
-            
-            bool result = cv_.wait_for(lk, timeout, [&] { 
-                return cid_.load(std::memory_order_relaxed) == id || closed_.load(std::memory_order_acquire); 
+            bool result = not_empty_.wait_for(lk, timeout, [&] { 
+                return !queue_.empty() || closed_.load(std::memory_order_acquire); 
             });
             
-            if (closed_.load(std::memory_order_acquire)) {
-                return false;
-            }
-            
-            if (!result) {
+            if (closed_.load(std::memory_order_acquire) || !result) {
                 return false;
             }
             
-            // Only copy the message if there is one
-            if (!message_.empty()) {
-                message_copy.swap(message_);
-            } else {
-                return true; // No message but condition satisfied
+            // Coalesce all pending events into one write
+            batch_.clear();
+            while (!queue_.empty()) {
+                batch_ += queue_.front();
+                queue_.pop_front();
             }
+            ++writes_;
         }
+        not_full_.notify_all();
         
+        // batch_ is only touched by the single consumer, so it can be written outside the lock
         try {
-            if (!message_copy.empty()) {
-                if (!sink->write(message_copy.data(), message_copy.size())) {
-                    close();
-                    return false;
-                }
+            if (!sink->write(batch_.data(), batch_.size())) {
+                close();
+                return false;
             }
             return true;
         } catch (...) {
@@ -98,30 +111,35 @@ public:
         }
     }
 
-    bool send_event(const std::string& message) {
+    bool send_event(std::string message, const std::chrono::milliseconds& max_wait = std::chrono::milliseconds(1000)) {
         if (closed_.load(std::memory_order_acquire) || message.empty()) {
             return false;
         }
         
         try {
-            std::lock_guard<std::mutex> lk(m_);
+            std::unique_lock<std::mutex> lk(m_);
+            
+            bool has_room = not_full_.wait_for(lk, max_wait, [&] {
+                return queue_.size() < max_queued_ || closed_.load(std::memory_order_acquire);
+            });
             
             if (closed_.load(std::memory_order_acquire)) {
                 return false;
             }
             
-            // Efficiently set the message and allocate space as needed
-            if (message.size() > message_.capacity()) {
-                message_.reserve(message.size() + 64); // Pre-allocate extra space to avoid frequent reallocations
+            if (!has_room) {
+                ++dropped_;
+                return false;
             }
-            message_ = message;
             
-            cid_.store(id_.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
-            cv_.notify_one(); // Notify waiting threads
-            return true;
+            queue_.push_back(std::move(message));
+            ++enqueued_;
+            max_queue_depth_ = std::max(max_queue_depth_, queue_.size());
         } catch (...) {
             return false;
         }
+        not_empty_.notify_one(); // Notify the waiting consumer
+        return true;
     }
     
     void close() {
@@ -131,7 +149,10 @@ public:
         }
         
         try {
-            cv_.notify_all();
+            // Take the lock so that a waiter cannot miss the notification between its check and its wait
+            std::lock_guard<std::mutex> lk(m_);
+            not_empty_.notify_all();
+            not_full_.notify_all();
         } catch (...) {
             // Ignore exceptions
         }
@@ -141,6 +162,24 @@ public:
         return closed_.load(std::memory_order_acquire);
     }
     
+    // Get the number of events waiting to be written
+    size_t queue_depth() const {
+        std::lock_guard<std::mutex> lk(m_);
+        return queue_.size();
+    }
+    
+    // Get a snapshot of the queue counters
+    event_dispatcher_stats stats() const {
+        std::lock_guard<std::mutex> lk(m_);
+        event_dispatcher_stats result;
+        result.queue_depth = queue_.size();
+        result.max_queue_depth = max_queue_depth_;
+        result.enqueued = enqueued_;
+        result.dropped = dropped_;
+        result.writes = writes_;
+        return result;
+    }
+    
     // Get the last activity time
     std::chrono::steady_clock::time_point last_activity() const {
         std::lock_guard<std::mutex> lk(m_);
@@ -155,10 +194,15 @@ public:
 
 private:
     mutable std::mutex m_;
-    std::condition_variable cv_;
-    std::atomic<int> id_{0};
-    std::atomic<int> cid_{-1};
-    std::string message_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::deque<std::string> queue_;
+    std::string batch_;
+    const size_t max_queued_;
+    size_t max_queue_depth_ = 0;
+    uint64_t enqueued_ = 0;
+    uint64_t dropped_ = 0;
+    uint64_t writes_ = 0;
     std::atomic<bool> closed_{false};
     std::chrono::steady_clock::time_point last_activity_{std::chrono::steady_clock::now()};
 };
@@ -199,6 +243,15 @@ public:
      * @return True if the server started successfully
      */
     bool start(bool blocking = true);
+
+    /**
+     * @brief Serve a single client over stdio (newline-delimited JSON-RPC) instead of HTTP+SSE
+     * @param in The stream to read requests from, one JSON message per line
+     * @param out The stream to write responses and server requests to, one JSON message per line
+     * @return True once the input stream ends, false if stdio is already being served
+     * @note Blocks the calling thread, which processes the requests one at a time and in order
+     */
+    bool start_stdio(std::istream& in = std::cin, std::ostream& out = std::cout);
     
     /**
      * @brief Stop the server
@@ -289,6 +342,12 @@ public:
      */
     bool set_mount_point(const std::string& mount_point, const std::string& dir, httplib::Headers headers = httplib::Headers());
 
+    /**
+     * @brief Get the event queue counters of all open sessions
+     * @return Map from session ID to a snapshot of its event queue counters
+     */
+    std::map<std::string, event_dispatcher_stats> get_event_stats() const;
+
 private:
     std::string host_;
     int port_;
@@ -342,6 +401,15 @@ private:
     // Map to track session initialization status (session_id -> initialized)
     std::map<std::string, bool> session_initialized_;
 
+    // Output stream of the stdio transport, if it is being served
+    std::ostream* stdio_out_ = nullptr;
+    
+    // Mutex serializing writes to stdio_out_
+    std::mutex stdio_mutex_;
+    
+    // Write one message to the stdio transport
+    void write_stdio(const json& message);
+
     // Handle SSE requests
     void handle_sse(const httplib::Request& req, httplib::Response& res);
     
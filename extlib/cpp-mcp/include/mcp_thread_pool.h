@@ -25,6 +25,8 @@ public:
      * @param num_threads Number of threads in the thread pool
      */
     explicit thread_pool(size_t num_threads = std::thread::hardware_concurrency()) : stop_(false) {
+        // hardware_concurrency() may return 0; a pool without workers would never run a task
+        num_threads = num_threads > 0 ? num_threads : 1;
         for (size_t i = 0; i < num_threads; ++i) {
             workers_.emplace_back([this] {
                 while (true) {
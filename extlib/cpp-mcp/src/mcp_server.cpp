@@ -90,6 +90,83 @@ bool server::start(bool blocking) {
     }
 }
 
+// Session ID of the single client served by start_stdio
+static const char STDIO_SESSION_ID[] = "stdio";
+
+bool server::start_stdio(std::istream& in, std::ostream& out) {
+    {
+        std::lock_guard<std::mutex> lock(stdio_mutex_);
+        if (stdio_out_) {
+            return false;  // Already serving stdio
+        }
+        stdio_out_ = &out;
+    }
+    
+    LOG_INFO("Starting MCP server on stdio");
+    
+    // Messages are framed by newlines; the line buffer is reused for every message
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty()) {
+            continue;
+        }
+        
+        json req_json;
+        try {
+            req_json = json::parse(line.begin(), line.end());
+        } catch (const json::exception& e) {
+            LOG_ERROR("Failed to parse JSON request: ", e.what());
+            write_stdio(response::create_error(nullptr, error_code::parse_error, "Invalid JSON").to_json());
+            continue;
+        }
+        
+        // Responses from the client to server requests carry no method
+        if (!req_json.is_object() || !req_json.contains("method")) {
+            continue;
+        }
+        
+        request mcp_req;
+        try {
+            mcp_req.jsonrpc = req_json["jsonrpc"].get<std::string>();
+            if (req_json.contains("id") && !req_json["id"].is_null()) {
+                mcp_req.id = req_json["id"];
+            }
+            mcp_req.method = req_json["method"].get<std::string>();
+            if (req_json.contains("params")) {
+                mcp_req.params = req_json["params"];
+            }
+        } catch (const std::exception& e) {
+            LOG_ERROR("Failed to create request object: ", e.what());
+            write_stdio(response::create_error(req_json.value("id", json()), error_code::invalid_request, "Invalid request format").to_json());
+            continue;
+        }
+        
+        json response_json = process_request(mcp_req, STDIO_SESSION_ID);
+        if (!mcp_req.is_notification()) {
+            write_stdio(response_json);
+        }
+    }
+    
+    LOG_INFO("Stdio input closed, stopping MCP server");
+    {
+        std::lock_guard<std::mutex> lock(stdio_mutex_);
+        stdio_out_ = nullptr;
+    }
+    set_session_initialized(STDIO_SESSION_ID, false);
+    return true;
+}
+
+void server::write_stdio(const json& message) {
+    std::lock_guard<std::mutex> lock(stdio_mutex_);
+    if (!stdio_out_) {
+        return;
+    }
+    *stdio_out_ << message.dump() << '\n' << std::flush;
+}
+
 void server::stop() {
     if (!running_) {
         return;
@@ -438,10 +515,15 @@ void server::handle_sse(const httplib::Request& req, httplib::Response& res) {
                 heartbeat << "event: heartbeat\r\ndata: " << heartbeat_count++ << "\r\n\r\n";
                 
                 try {
-                    bool sent = session_dispatcher->send_event(heartbeat.str());
+                    // Do not wait for room: a full queue already keeps the connection busy, so the heartbeat can be skipped
+                    bool sent = session_dispatcher->send_event(heartbeat.str(), std::chrono::milliseconds(0));
                     if (!sent) {
-                        LOG_WARNING("Failed to send heartbeat, client may have closed connection: ", session_id);
-                        break;
+                        if (session_dispatcher->is_closed()) {
+                            LOG_WARNING("Failed to send heartbeat, client may have closed connection: ", session_id);
+                            break;
+                        }
+                        LOG_DEBUG("Event queue full, skipped heartbeat: ", session_id);
+                        continue;
                     }
                     
                     // Update activity time (heartbeat successful)
@@ -654,12 +736,10 @@ json server::process_request(const request& req, const std::string& session_id)
         }
         
         if (handler) {
-            // Call handler
+            // Call handler inline: process_request already runs on a thread_pool_ worker, and waiting here for a
+            // nested task on the same pool deadlocks once every worker is waiting.
             LOG_INFO("Calling method handler: ", req.method);
-            auto future = thread_pool_.enqueue([handler, params = req.params, session_id]() -> json {
-                return handler(params, session_id);
-            });
-            json result = future.get();
+            json result = handler(req.params, session_id);
             
             // Create success response
             LOG_INFO("Method call successful: ", req.method);
@@ -770,6 +850,12 @@ void server::send_jsonrpc(const std::string& session_id, const json& message) {
         return;
     }
 
+    // The stdio client has no dispatcher
+    if (session_id == STDIO_SESSION_ID) {
+        write_stdio(message);
+        return;
+    }
+
     // Get session dispatcher
     std::shared_ptr<event_dispatcher> dispatcher;
     {
@@ -829,7 +915,7 @@ void server::set_session_initialized(const std::string& session_id, bool initial
         std::lock_guard<std::mutex> lock(mutex_);
         // Check if session still exists
         auto it = session_dispatchers_.find(session_id);
-        if (it == session_dispatchers_.end()) {
+        if (it == session_dispatchers_.end() && session_id != STDIO_SESSION_ID) {
             LOG_WARNING("Cannot set initialization state for non-existent session: ", session_id);
             return;
         }
@@ -905,6 +991,15 @@ bool server::set_mount_point(const std::string& mount_point, const std::string&
     return http_server_->set_mount_point(mount_point, dir, headers);
 }
 
+std::map<std::string, event_dispatcher_stats> server::get_event_stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<std::string, event_dispatcher_stats> result;
+    for (const auto& [session_id, dispatcher] : session_dispatchers_) {
+        result[session_id] = dispatcher->stats();
+    }
+    return result;
+}
+
 void server::close_session(const std::string& session_id) {
      // Clean up resources safely
     try {
@@ -941,6 +1036,11 @@ void server::close_session(const std::string& session_id) {
         if (dispatcher_to_close && !dispatcher_to_close->is_closed()) {
             dispatcher_to_close->close();
         }
+        if (dispatcher_to_close) {
+            auto stats = dispatcher_to_close->stats();
+            LOG_DEBUG("Session event queue: ", session_id, ", enqueued=", stats.enqueued, ", dropped=", stats.dropped,
+                      ", writes=", stats.writes, ", max_depth=", stats.max_queue_depth);
+        }
         
         // Release thread resources
         if (thread_to_release) {
@@ -658,6 +658,68 @@ TEST_F(ToolsTest, CallTool) {
     EXPECT_EQ(tool_result["content"][0]["text"], "Current weather in New York:\nTemperature: 72°F\nConditions: Partly cloudy");
 }
 
+// Test the per-session SSE event queue
+class EventDispatcherTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        sink_.write = [this](const char* data, size_t data_len) {
+            written_.emplace_back(data, data_len);
+            return true;
+        };
+    }
+
+    httplib::DataSink sink_;
+    std::vector<std::string> written_;
+};
+
+// Events sent before the consumer drains the queue are all delivered, in order, in one write
+TEST_F(EventDispatcherTest, CoalescesPendingEvents) {
+    event_dispatcher dispatcher;
+    EXPECT_TRUE(dispatcher.send_event("event: message\r\ndata: 1\r\n\r\n"));
+    EXPECT_TRUE(dispatcher.send_event("event: heartbeat\r\ndata: 0\r\n\r\n"));
+    EXPECT_TRUE(dispatcher.send_event("event: message\r\ndata: 2\r\n\r\n"));
+
+    EXPECT_TRUE(dispatcher.wait_event(&sink_, std::chrono::milliseconds(100)));
+    ASSERT_EQ(written_.size(), 1);
+    EXPECT_EQ(written_[0], "event: message\r\ndata: 1\r\n\r\n"
+                           "event: heartbeat\r\ndata: 0\r\n\r\n"
+                           "event: message\r\ndata: 2\r\n\r\n");
+
+    auto stats = dispatcher.stats();
+    EXPECT_EQ(stats.enqueued, 3);
+    EXPECT_EQ(stats.writes, 1);
+    EXPECT_EQ(stats.max_queue_depth, 3);
+    EXPECT_EQ(stats.queue_depth, 0);
+}
+
+// A full queue rejects new events once the wait for room expires, and accepts them again after draining
+TEST_F(EventDispatcherTest, RejectsWhenFull) {
+    event_dispatcher dispatcher(2);
+    EXPECT_TRUE(dispatcher.send_event("a", std::chrono::milliseconds(0)));
+    EXPECT_TRUE(dispatcher.send_event("b", std::chrono::milliseconds(0)));
+    EXPECT_FALSE(dispatcher.send_event("c", std::chrono::milliseconds(10)));
+    EXPECT_EQ(dispatcher.stats().dropped, 1);
+
+    EXPECT_TRUE(dispatcher.wait_event(&sink_, std::chrono::milliseconds(100)));
+    EXPECT_TRUE(dispatcher.send_event("d", std::chrono::milliseconds(0)));
+    EXPECT_TRUE(dispatcher.wait_event(&sink_, std::chrono::milliseconds(100)));
+    ASSERT_EQ(written_.size(), 2);
+    EXPECT_EQ(written_[0], "ab");
+    EXPECT_EQ(written_[1], "d");
+}
+
+// A producer blocked on a full queue proceeds as soon as the consumer makes room
+TEST_F(EventDispatcherTest, BlocksUntilDrained) {
+    event_dispatcher dispatcher(1);
+    EXPECT_TRUE(dispatcher.send_event("a"));
+    std::thread producer([&] { EXPECT_TRUE(dispatcher.send_event("b", std::chrono::milliseconds(5000))); });
+    EXPECT_TRUE(dispatcher.wait_event(&sink_, std::chrono::milliseconds(100)));
+    producer.join();
+    EXPECT_TRUE(dispatcher.wait_event(&sink_, std::chrono::milliseconds(100)));
+    ASSERT_EQ(written_.size(), 2);
+    EXPECT_EQ(written_[1], "b");
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     
@@ -1,5 +1,8 @@
 #include "ExcelOperator.h"
 
+#include <algorithm>
+#include <unordered_map>
+
 namespace ExcelWrapper {
 
 ExcelOperator::ExcelOperator() : m_isOpen(false) {
@@ -18,11 +21,12 @@ bool ExcelOperator::open(const std::string& filePath, std::vector<std::string>&
     m_document.open(filePath);
     m_workbook = m_document.workbook();
 
-    for (uint32_t i = 1; i <= m_workbook.sheetCount(); ++i) {
-        sheetNames.emplace_back(m_workbook.sheet(i).name());
-    }
+    // Listing the names from the workbook does not build the XML documents of the sheets
+    std::vector<std::string> names = m_workbook.sheetNames();
+    sheetNames.insert(sheetNames.end(), names.begin(), names.end());
 
-    m_currentSheet = m_workbook.worksheet(1);
+    std::vector<std::string> worksheetNames = m_workbook.worksheetNames();
+    m_currentSheetName = worksheetNames.empty() ? std::string() : worksheetNames.front();
     m_isOpen = true;
     return true;
 }
@@ -33,7 +37,7 @@ bool ExcelOperator::create(const std::string& filePath) {
     }
     m_document.create(filePath, OpenXLSX::XLForceOverwrite);
     m_workbook = m_document.workbook();
-    m_currentSheet = m_workbook.worksheet("Sheet1");
+    m_currentSheetName = "Sheet1";
     m_isOpen = true;
     return true;
 }
@@ -58,6 +62,9 @@ bool ExcelOperator::close() {
     if (m_isOpen) {
         try {
             m_document.close();
+            m_currentSheet.reset();
+            m_currentSheetName.clear();
+            m_loadedSheets.clear();
             m_isOpen = false;
             return true;
         } catch (const std::exception& e) {
@@ -68,10 +75,13 @@ bool ExcelOperator::close() {
 }
 
 bool ExcelOperator::selectSheet(const std::string& sheetName) {
-    if (!m_isOpen) {
+    if (!m_isOpen || !m_workbook.worksheetExists(sheetName)) {
         return false;
     }
-    m_currentSheet = m_workbook.worksheet(sheetName);
+    if (sheetName != m_currentSheetName) {
+        m_currentSheet.reset();
+        m_currentSheetName = sheetName;
+    }
     return true;
 }
 
@@ -80,6 +90,8 @@ bool ExcelOperator::selectSheet(uint32_t sheetIndex) {
         return false;
     }
     m_currentSheet = m_workbook.worksheet(sheetIndex);
+    m_currentSheetName = m_currentSheet->name();
+    m_loadedSheets.insert(m_currentSheetName);
     return true;
 }
 
@@ -96,6 +108,11 @@ bool ExcelOperator::deleteSheet(const std::string& sheetName) {
         return false;
     }
     m_workbook.deleteSheet(sheetName);
+    m_loadedSheets.erase(sheetName);
+    if (sheetName == m_currentSheetName) {
+        m_currentSheet.reset();
+        m_currentSheetName.clear();
+    }
     return true;
 }
 
@@ -104,6 +121,11 @@ bool ExcelOperator::renameSheet(const std::string& oldName, const std::string& n
         return false;
     }
     m_workbook.worksheet(oldName).setName(newName);
+    m_loadedSheets.erase(oldName);
+    m_loadedSheets.insert(newName);
+    if (oldName == m_currentSheetName) {
+        m_currentSheetName = newName;
+    }
     return true;
 }
 
@@ -114,28 +136,44 @@ uint32_t ExcelOperator::sheetCount() const {
     return m_workbook.sheetCount();
 }
 
+std::vector<std::string> ExcelOperator::sheetNames() const {
+    if (!m_isOpen) {
+        return {};
+    }
+    return m_workbook.sheetNames();
+}
+
 std::string ExcelOperator::currentSheetName() const {
     if (!m_isOpen) {
         return "";
     }
-    return m_currentSheet.name();
+    return m_currentSheetName;
 }
 
 bool ExcelOperator::clearCell(uint32_t row, uint32_t column) {
     if (!m_isOpen) {
         return false;
     }
-    m_currentSheet.cell(row, column).clear(0);
+    currentSheet().cell(row, column).clear(0);
     return true;
 }
 
 bool ExcelOperator::mergeCells(uint32_t firstRow, uint32_t firstColumn, uint32_t lastRow, uint32_t lastColumn) {
+    return mergeCells(std::vector<CellRange>{{firstRow, firstColumn, lastRow, lastColumn}});
+}
+
+bool ExcelOperator::mergeCells(const std::vector<CellRange>& ranges) {
     if (!m_isOpen) {
         return false;
     }
-    OpenXLSX::XLCellReference topLeft(firstColumn, firstRow);
-    OpenXLSX::XLCellReference bottomRight(lastColumn, lastRow);
-    m_currentSheet.mergeCells(m_currentSheet.range(topLeft, bottomRight));
+    std::vector<std::string> references;
+    references.reserve(ranges.size());
+    for (const auto& range : ranges) {
+        OpenXLSX::XLCellReference topLeft(range.firstRow, static_cast<uint16_t>(range.firstColumn));
+        OpenXLSX::XLCellReference bottomRight(range.lastRow, static_cast<uint16_t>(range.lastColumn));
+        references.push_back(topLeft.address() + ":" + bottomRight.address());
+    }
+    currentSheet().merges().appendMerges(references);
     return true;
 }
 
@@ -143,225 +181,171 @@ bool ExcelOperator::unmergeCells(uint32_t firstRow, uint32_t firstColumn, uint32
     if (!m_isOpen) {
         return false;
     }
-    OpenXLSX::XLCellReference topLeft(firstColumn, firstRow);
-    OpenXLSX::XLCellReference bottomRight(lastColumn, lastRow);
-    m_currentSheet.unmergeCells(m_currentSheet.range(topLeft, bottomRight));
+    OpenXLSX::XLCellReference topLeft(firstRow, static_cast<uint16_t>(firstColumn));
+    OpenXLSX::XLCellReference bottomRight(lastRow, static_cast<uint16_t>(lastColumn));
+    currentSheet().unmergeCells(currentSheet().range(topLeft, bottomRight));
     return true;
 }
 
-bool ExcelOperator::setCellFontColor(uint32_t row, uint32_t column, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha) {
-    if (!m_isOpen || row < 1 || column < 1) {
+bool ExcelOperator::setComments(const std::vector<CellComment>& comments, const std::string& author) {
+    if (!m_isOpen) {
         return false;
     }
-    
-    try {
-        auto& styles = m_document.styles();
-        auto cell = m_currentSheet.cell(row, column);
-        
-        auto currentFormatIndex = cell.cellFormat();
-        auto currentFormat = styles.cellFormats()[currentFormatIndex];
-        
-        auto font = styles.fonts()[currentFormat.fontIndex()];
-        auto newFont = font;
-        newFont.setFontColor(OpenXLSX::XLColor(red, green, blue, alpha));
-        auto newFontIndex = styles.fonts().create(newFont);
-        
-        auto newFormat = currentFormat;
-        newFormat.setFontIndex(newFontIndex);
-        auto newFormatIndex = styles.cellFormats().create(newFormat);
-        
-        cell.setCellFormat(newFormatIndex);
-        
-        return true;
-    } catch (const std::exception& e) {
-        return false;
+    std::vector<OpenXLSX::XLCommentEntry> entries;
+    entries.reserve(comments.size());
+    for (const auto& comment : comments) {
+        OpenXLSX::XLCellReference reference(comment.row, static_cast<uint16_t>(comment.column));
+        entries.push_back({reference.address(), comment.text, 0});
     }
-}
 
-bool ExcelOperator::setCellBackgroundColor(uint32_t row, uint32_t column, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha) {
-    if (!m_isOpen || row < 1 || column < 1) {
-        return false;
+    OpenXLSX::XLComments& sheetComments = currentSheet().comments();
+    uint16_t authorId = 0;
+    uint16_t authorCount = sheetComments.authorCount();
+    while (authorId < authorCount && sheetComments.author(authorId) != author) {
+        ++authorId;
     }
-    
-    try {
-        auto& styles = m_document.styles();
-        auto cell = m_currentSheet.cell(row, column);
-        
-        auto currentFormatIndex = cell.cellFormat();
-        auto currentFormat = styles.cellFormats()[currentFormatIndex];
-        
-        auto fill = styles.fills()[currentFormat.fillIndex()];
-        auto newFill = fill;
-        newFill.setBackgroundColor(OpenXLSX::XLColor(red, green, blue, alpha));
-        auto newFillIndex = styles.fills().create(newFill);
-        
-        auto newFormat = currentFormat;
-        newFormat.setFillIndex(newFillIndex);
-        auto newFormatIndex = styles.cellFormats().create(newFormat);
-        
-        cell.setCellFormat(newFormatIndex);
-        
-        return true;
-    } catch (const std::exception& e) {
-        return false;
+    if (authorId == authorCount) {
+        authorId = sheetComments.addAuthor(author);
     }
+    for (auto& entry : entries) {
+        entry.authorId = authorId;
+    }
+    return sheetComments.set(entries);
+}
+
+bool ExcelOperator::setCellFontColor(uint32_t row, uint32_t column, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha) {
+    CellStyle style;
+    style.fontColor = OpenXLSX::XLColor(alpha, red, green, blue);
+    return setRangeStyle(row, column, row, column, style);
+}
+
+bool ExcelOperator::setCellBackgroundColor(uint32_t row, uint32_t column, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha) {
+    CellStyle style;
+    style.backgroundColor = OpenXLSX::XLColor(alpha, red, green, blue);
+    return setRangeStyle(row, column, row, column, style);
 }
 
 bool ExcelOperator::setCellFontSize(uint32_t row, uint32_t column, uint16_t size) {
-    if (!m_isOpen || row < 1 || column < 1) {
-        return false;
-    }
-    
-    try {
-        auto& styles = m_document.styles();
-        auto cell = m_currentSheet.cell(row, column);
-        
-        auto currentFormatIndex = cell.cellFormat();
-        auto currentFormat = styles.cellFormats()[currentFormatIndex];
-        
-        auto font = styles.fonts()[currentFormat.fontIndex()];
-        auto newFont = font;
-        newFont.setFontSize(size);
-        auto newFontIndex = styles.fonts().create(newFont);
-        
-        auto newFormat = currentFormat;
-        newFormat.setFontIndex(newFontIndex);
-        auto newFormatIndex = styles.cellFormats().create(newFormat);
-        
-        cell.setCellFormat(newFormatIndex);
-        return true;
-    } catch (const std::exception& e) {
-        return false;
-    }
+    CellStyle style;
+    style.fontSize = size;
+    return setRangeStyle(row, column, row, column, style);
 }
 
 bool ExcelOperator::setCellFontBold(uint32_t row, uint32_t column, bool bold) {
-    if (!m_isOpen || row < 1 || column < 1) {
-        return false;
-    }
-    
-    try {
-        auto& styles = m_document.styles();
-        auto cell = m_currentSheet.cell(row, column);
-        
-        auto currentFormatIndex = cell.cellFormat();
-        auto currentFormat = styles.cellFormats()[currentFormatIndex];
-        
-        auto font = styles.fonts()[currentFormat.fontIndex()];
-        auto newFont = font;
-        newFont.setBold(bold);
-        auto newFontIndex = styles.fonts().create(newFont);
-        
-        auto newFormat = currentFormat;
-        newFormat.setFontIndex(newFontIndex);
-        auto newFormatIndex = styles.cellFormats().create(newFormat);
-        
-        cell.setCellFormat(newFormatIndex);
-        return true;
-    } catch (const std::exception& e) {
-        return false;
-    }
+    CellStyle style;
+    style.bold = bold;
+    return setRangeStyle(row, column, row, column, style);
 }
 
 bool ExcelOperator::setCellFontItalic(uint32_t row, uint32_t column, bool italic) {
-    if (!m_isOpen || row < 1 || column < 1) {
-        return false;
-    }
-    
-    try {
-        auto& styles = m_document.styles();
-        auto cell = m_currentSheet.cell(row, column);
-        
-        auto currentFormatIndex = cell.cellFormat();
-        auto currentFormat = styles.cellFormats()[currentFormatIndex];
-        
-        auto font = styles.fonts()[currentFormat.fontIndex()];
-        auto newFont = font;
-        newFont.setItalic(italic);
-        auto newFontIndex = styles.fonts().create(newFont);
-        
-        auto newFormat = currentFormat;
-        newFormat.setFontIndex(newFontIndex);
-        auto newFormatIndex = styles.cellFormats().create(newFormat);
-        
-        cell.setCellFormat(newFormatIndex);
-        return true;
-    } catch (const std::exception& e) {
-        return false;
-    }
+    CellStyle style;
+    style.italic = italic;
+    return setRangeStyle(row, column, row, column, style);
 }
 
 bool ExcelOperator::setCellFontUnderline(uint32_t row, uint32_t column, bool underline) {
-    if (!m_isOpen || row < 1 || column < 1) {
+    CellStyle style;
+    style.underline = underline;
+    return setRangeStyle(row, column, row, column, style);
+}
+
+bool ExcelOperator::setCellAlignment(uint32_t row, uint32_t column, const std::string& horizontal, const std::string& vertical) {
+    CellStyle style;
+    style.horizontalAlignment = horizontal;
+    style.verticalAlignment = vertical;
+    return setRangeStyle(row, column, row, column, style);
+}
+
+bool ExcelOperator::setRangeStyle(uint32_t firstRow, uint32_t firstColumn, uint32_t lastRow, uint32_t lastColumn, const CellStyle& style) {
+    if (!m_isOpen || firstRow < 1 || firstColumn < 1 || firstRow > lastRow || firstColumn > lastColumn ||
+        lastRow > OpenXLSX::MAX_ROWS || lastColumn > OpenXLSX::MAX_COLS) {
         return false;
     }
-    
+
     try {
-        auto& styles = m_document.styles();
-        auto cell = m_currentSheet.cell(row, column);
-        
-        auto currentFormatIndex = cell.cellFormat();
-        auto currentFormat = styles.cellFormats()[currentFormatIndex];
-        
-        auto font = styles.fonts()[currentFormat.fontIndex()];
-        auto newFont = font;
-        newFont.setUnderline(underline ? OpenXLSX::XLUnderlineSingle : OpenXLSX::XLUnderlineNone);
-        auto newFontIndex = styles.fonts().create(newFont);
-        
-        auto newFormat = currentFormat;
-        newFormat.setFontIndex(newFontIndex);
-        auto newFormatIndex = styles.cellFormats().create(newFormat);
-        
-        cell.setCellFormat(newFormatIndex);
+        // Cells sharing a format share the derived format too, so it is only computed once per source format
+        std::unordered_map<OpenXLSX::XLStyleIndex, OpenXLSX::XLStyleIndex> derivedFormats;
+        auto rows = currentSheet().rows(firstRow, lastRow);
+        for (auto& row : rows) {
+            for (auto& cell : row.cells(static_cast<uint16_t>(firstColumn), static_cast<uint16_t>(lastColumn))) {
+                OpenXLSX::XLStyleIndex sourceFormatIndex = cell.cellFormat();
+                auto derived = derivedFormats.find(sourceFormatIndex);
+                if (derived == derivedFormats.end()) {
+                    derived = derivedFormats.emplace(sourceFormatIndex, deriveCellFormat(sourceFormatIndex, style)).first;
+                }
+                cell.setCellFormat(derived->second);
+            }
+        }
         return true;
     } catch (const std::exception& e) {
         return false;
     }
 }
 
-bool ExcelOperator::setCellAlignment(uint32_t row, uint32_t column, const std::string& horizontal, const std::string& vertical) {
-    if (!m_isOpen || row < 1 || column < 1) {
-        return false;
+OpenXLSX::XLStyleIndex ExcelOperator::deriveCellFormat(OpenXLSX::XLStyleIndex sourceFormatIndex, const CellStyle& style) {
+    auto& styles = m_document.styles();
+    auto& cellFormats = styles.cellFormats();
+
+    // Entries are copied before they are modified, as XLFont, XLFill and XLCellFormat objects refer to the shared XML entry
+    OpenXLSX::XLStyleIndex formatIndex = cellFormats.create(cellFormats[sourceFormatIndex]);
+    OpenXLSX::XLCellFormat format = cellFormats[formatIndex];
+
+    if (style.fontColor || style.fontSize || style.bold || style.italic || style.underline) {
+        auto& fonts = styles.fonts();
+        OpenXLSX::XLStyleIndex fontIndex = fonts.create(fonts[format.fontIndex()]);
+        OpenXLSX::XLFont font = fonts[fontIndex];
+        if (style.fontColor) {
+            font.setFontColor(*style.fontColor);
+        }
+        if (style.fontSize) {
+            font.setFontSize(*style.fontSize);
+        }
+        if (style.bold) {
+            font.setBold(*style.bold);
+        }
+        if (style.italic) {
+            font.setItalic(*style.italic);
+        }
+        if (style.underline) {
+            font.setUnderline(*style.underline ? OpenXLSX::XLUnderlineSingle : OpenXLSX::XLUnderlineNone);
+        }
+        format.setFontIndex(fonts.intern(fontIndex));
     }
-    
-    try {
-        auto& styles = m_document.styles();
-        auto cell = m_currentSheet.cell(row, column);
-        
-        auto currentFormatIndex = cell.cellFormat();
-        auto currentFormat = styles.cellFormats()[currentFormatIndex];
-        auto newFormat = currentFormat;
-        
-        auto alignment = newFormat.alignment();
-        if (horizontal == "left") {
+
+    if (style.backgroundColor) {
+        auto& fills = styles.fills();
+        OpenXLSX::XLStyleIndex fillIndex = fills.create(fills[format.fillIndex()]);
+        fills[fillIndex].setBackgroundColor(*style.backgroundColor);
+        format.setFillIndex(fills.intern(fillIndex));
+    }
+
+    if (style.horizontalAlignment || style.verticalAlignment) {
+        auto alignment = format.alignment(OpenXLSX::XLCreateIfMissing);
+        if (style.horizontalAlignment == "left") {
             alignment.setHorizontal(OpenXLSX::XLAlignmentStyle::XLAlignLeft);
-        } else if (horizontal == "center") {
+        } else if (style.horizontalAlignment == "center") {
             alignment.setHorizontal(OpenXLSX::XLAlignmentStyle::XLAlignCenter);
-        } else if (horizontal == "right") {
+        } else if (style.horizontalAlignment == "right") {
             alignment.setHorizontal(OpenXLSX::XLAlignmentStyle::XLAlignRight);
         }
 
-        if (vertical == "top") {
+        if (style.verticalAlignment == "top") {
             alignment.setVertical(OpenXLSX::XLAlignmentStyle::XLAlignTop);
-        } else if (vertical == "bottom") {
+        } else if (style.verticalAlignment == "bottom") {
             alignment.setVertical(OpenXLSX::XLAlignmentStyle::XLAlignBottom);
         }
 
-        newFormat.setApplyAlignment(true);
-        
-        auto newFormatIndex = styles.cellFormats().create(newFormat);
-        cell.setCellFormat(newFormatIndex);
-        return true;
-    } catch (const std::exception& e) {
-        return false;
+        format.setApplyAlignment(true);
     }
+
+    return cellFormats.intern(formatIndex);
 }
 
 bool ExcelOperator::setColumnWidth(uint32_t column, double width) {
     if (!m_isOpen) {
         return false;
     }
-    m_currentSheet.column(column).setWidth(width);
+    currentSheet().column(column).setWidth(width);
     return true;
 }
 
@@ -369,7 +353,7 @@ bool ExcelOperator::setRowHeight(uint32_t row, double height) {
     if (!m_isOpen) {
         return false;
     }
-    m_currentSheet.row(row).setHeight(height);
+    currentSheet().row(row).setHeight(height);
     return true;
 }
 
@@ -377,14 +361,122 @@ uint32_t ExcelOperator::columnCount() const {
     if (!m_isOpen) {
         return 0;
     }
-    return m_currentSheet.columnCount();
+    return currentSheet().columnCount();
 }
 
 uint32_t ExcelOperator::rowCount() const {
     if (!m_isOpen) {
         return 0;
     }
-    return m_currentSheet.rowCount();
+    return currentSheet().rowCount();
+}
+
+bool ExcelOperator::usedRange(CellRange& range) {
+    if (!m_isOpen) {
+        return false;
+    }
+
+    if (!m_loadedSheets.count(m_currentSheetName)) {
+        // Only the start of the sheet XML is read for its <dimension>, and it is checked against the first row that has
+        // cells, like the worksheet does when it is loaded. "A1" needs a closer look: Excel writes it for a sheet without
+        // cells, and older versions of OpenXLSX wrote it for every sheet and never updated it, so it is only taken as the
+        // cell A1 if that is the only cell of the sheet. In all other cases the sheet is loaded below.
+        OpenXLSX::XLStreamReader reader = m_workbook.streamWorksheet(m_currentSheetName);
+        const std::string ref = reader.dimension();
+        const size_t colon = ref.find(':');
+        try {
+            OpenXLSX::XLCellReference first(ref.substr(0, colon));
+            OpenXLSX::XLCellReference last(colon == std::string::npos ? ref : ref.substr(colon + 1));
+            bool hasCells = false;
+            while (reader.nextRow()) {
+                if (!reader.values().empty()) {
+                    hasCells = true;
+                    break;
+                }
+            }
+
+            if (ref != "A1") {
+                if (hasCells && reader.rowNumber() == first.row() && reader.values().size() <= last.column()) {
+                    range = {first.row(), first.column(), last.row(), last.column()};
+                    return true;
+                }
+            } else if (!hasCells) {
+                return false;
+            } else if (reader.rowNumber() == 1 && reader.values().size() == 1) {
+                bool onlyCell = true;
+                while (onlyCell && reader.nextRow()) {
+                    onlyCell = reader.values().empty();
+                }
+                if (onlyCell) {
+                    range = {1, 1, 1, 1};
+                    return true;
+                }
+            }
+        } catch (const OpenXLSX::XLCellAddressError&) {
+            // No valid <dimension>: the sheet is loaded below
+        }
+    }
+
+    if (currentSheet().columnCount() == 0) {
+        return false;
+    }
+    OpenXLSX::XLCellRange used = currentSheet().usedRange();
+    range = {used.topLeft().row(), used.topLeft().column(), used.bottomRight().row(), used.bottomRight().column()};
+    return true;
+}
+
+bool ExcelOperator::visitRangeRows(uint32_t firstRow, uint32_t firstColumn, uint32_t lastRow, uint32_t lastColumn, const RowVisitor& visitor) {
+    if (!m_isOpen || firstRow == 0 || firstColumn == 0 || firstRow > lastRow || firstColumn > lastColumn) {
+        return false;
+    }
+
+    if (!m_loadedSheets.count(m_currentSheetName)) {
+        // Parsing the whole sheet would dominate a read of its first rows, so the rows are read from the sheet XML as
+        // it is decompressed, and decompression stops after lastRow
+        std::vector<OpenXLSX::XLCellValue> rowValues(lastColumn - firstColumn + 1);
+        OpenXLSX::XLStreamReader reader = m_workbook.streamWorksheet(m_currentSheetName);
+        while (reader.nextRow() && reader.rowNumber() <= lastRow) {
+            if (reader.rowNumber() < firstRow) {
+                continue;
+            }
+            const std::vector<OpenXLSX::XLCellValue>& cells = reader.values();
+            for (uint32_t c = firstColumn; c <= lastColumn; ++c) {
+                rowValues[c - firstColumn] = c <= cells.size() ? cells[c - 1] : OpenXLSX::XLCellValue();
+            }
+            visitor(reader.rowNumber(), rowValues);
+        }
+        return true;
+    }
+
+    // Nothing exists past the last row node, so there is no need to step through the row numbers beyond it
+    lastRow = std::min(lastRow, currentSheet().rowCount());
+    if (firstRow > lastRow) {
+        return true;
+    }
+
+    std::vector<OpenXLSX::XLCellValue> rowValues(lastColumn - firstColumn + 1);
+    auto rows = currentSheet().rows(firstRow, lastRow);
+    for (auto it = rows.begin(); it != rows.end(); ++it) {
+        if (!it.rowExists()) {
+            continue;
+        }
+        std::vector<OpenXLSX::XLCellValue> cells = it->values();
+        for (uint32_t c = firstColumn; c <= lastColumn; ++c) {
+            rowValues[c - firstColumn] = c <= cells.size() ? std::move(cells[c - 1]) : OpenXLSX::XLCellValue();
+        }
+        visitor(it.rowNumber(), rowValues);
+    }
+    return true;
+}
+
+bool ExcelOperator::getRangeColumns(uint32_t firstRow, uint32_t firstColumn, uint32_t lastRow, uint32_t lastColumn, OpenXLSX::XLColumnarRange& columns) {
+    if (!m_isOpen || firstRow == 0 || firstColumn == 0 || firstRow > lastRow || firstColumn > lastColumn ||
+        lastRow > OpenXLSX::MAX_ROWS || lastColumn > OpenXLSX::MAX_COLS) {
+        return false;
+    }
+    columns = currentSheet().columnarRange(OpenXLSX::XLCellReference(firstRow, static_cast<uint16_t>(firstColumn)),
+                                           OpenXLSX::XLCellReference(lastRow, static_cast<uint16_t>(lastColumn)));
+    return true;
 }
 
 std::vector<std::vector<OpenXLSX::XLCellValue>> ExcelOperator::getRangeValues(uint32_t firstRow, uint32_t firstColumn, uint32_t lastRow, uint32_t lastColumn) {
@@ -393,34 +485,80 @@ std::vector<std::vector<OpenXLSX::XLCellValue>> ExcelOperator::getRangeValues(ui
         return rangeData;
     }
 
-    for (uint32_t r = firstRow; r <= lastRow; ++r) {
-        std::vector<OpenXLSX::XLCellValue> rowData;
-        for (uint32_t c = firstColumn; c <= lastColumn; ++c) {
-            OpenXLSX::XLCell cell = m_currentSheet.cell(r, c);
-            if (cell) {
-                rowData.push_back(cell.value());
-            } else {
-                rowData.push_back(OpenXLSX::XLCellValue());
-            }
-        }
-        rangeData.push_back(rowData);
-    }
+    visitRangeRows(firstRow, firstColumn, lastRow, lastColumn,
+                   [&](uint32_t rowNumber, const std::vector<OpenXLSX::XLCellValue>& values) {
+                       rangeData.resize(rowNumber - firstRow, std::vector<OpenXLSX::XLCellValue>(values.size()));
+                       rangeData.push_back(values);
+                   });
+    rangeData.resize(lastRow - firstRow + 1, std::vector<OpenXLSX::XLCellValue>(lastColumn - firstColumn + 1));
     return rangeData;
 }
 
 bool ExcelOperator::setRangeValues(uint32_t firstRow, uint32_t firstColumn, const std::vector<std::vector<XLCellValue>>& values) {
-    if (!m_isOpen) {
+    if (!m_isOpen || firstRow == 0 || firstColumn == 0) {
+        return false;
+    }
+    if (values.empty()) {
+        return true;
+    }
+
+    size_t width = 0;
+    for (const auto& rowValues : values) {
+        width = std::max(width, rowValues.size());
+    }
+    if (firstRow - 1 + values.size() > OpenXLSX::MAX_ROWS || firstColumn - 1 + width > OpenXLSX::MAX_COLS) {
         return false;
     }
 
-    for (size_t r = 0; r < values.size(); ++r) {
-        for (size_t c = 0; c < values[r].size(); ++c) {
-            OpenXLSX::XLCellReference cellRef(firstRow + r, firstColumn + c);
-            setCellValue(cellRef.address(), values[r][c]);
+    // Rows and cells are visited in sheet order, so every row node is located or created once and every cell node is
+    // found or inserted next to its predecessor instead of being looked up by address.
+    auto rows = currentSheet().rows(firstRow, static_cast<uint32_t>(firstRow + values.size() - 1));
+    auto rowValues = values.begin();
+    for (auto it = rows.begin(); it != rows.end(); ++it, ++rowValues) {
+        if (rowValues->empty()) {
+            continue;
         }
+        auto cells = it->cells(static_cast<uint16_t>(firstColumn), static_cast<uint16_t>(firstColumn + rowValues->size() - 1));
+        auto value = rowValues->begin();
+        for (auto& cell : cells) {
+            cell.value() = *value++;
+        }
+    }
+    return true;
+}
+
+bool ExcelOperator::writeSheetRows(const std::string& sheetName, const RowSource& source, uint32_t& rowCount) {
+    rowCount = 0;
+    if (!m_isOpen) {
+        return false;
+    }
+    if (!m_workbook.worksheetExists(sheetName)) {
+        m_workbook.addWorksheet(sheetName);
     }
-    this->save();
+
+    // The writer discards the sheet's XML document when it is closed, so the worksheet must not be held on to
+    m_loadedSheets.erase(sheetName);
+    if (sheetName == m_currentSheetName) {
+        m_currentSheet.reset();
+    }
+
+    OpenXLSX::XLStreamWriter writer = m_workbook.worksheetWriter(sheetName);
+    std::vector<OpenXLSX::XLCellValue> values;
+    while (source(values)) {
+        writer.appendRow(values);
+        values.clear();
+    }
+    writer.close();
+    rowCount = writer.rowNumber();
     return true;
 }
 
+OpenXLSX::XLWorksheet& ExcelOperator::currentSheet() const {
+    if (!m_currentSheet) {
+        m_currentSheet = m_document.workbook().worksheet(m_currentSheetName);
+        m_loadedSheets.insert(m_currentSheetName);
+    }
+    return *m_currentSheet;
+}
+
 } // namespace ExcelWrapper
@@ -4,6 +4,9 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include <functional>
+#include <optional>
+#include <unordered_set>
 
 #include <OpenXLSX.hpp>
 
@@ -11,8 +14,39 @@ using OpenXLSX::XLCellValue;
 
 namespace ExcelWrapper {
 
+// Formatting changes to apply to cells. Properties that are not set keep the value of each cell's current format.
+struct CellStyle {
+    std::optional<OpenXLSX::XLColor> fontColor;
+    std::optional<OpenXLSX::XLColor> backgroundColor;
+    std::optional<uint16_t> fontSize;
+    std::optional<bool> bold;
+    std::optional<bool> italic;
+    std::optional<bool> underline;
+    std::optional<std::string> horizontalAlignment;
+    std::optional<std::string> verticalAlignment;
+};
+
+// A rectangular range of cells, by 1-based row and column numbers.
+struct CellRange {
+    uint32_t firstRow;
+    uint32_t firstColumn;
+    uint32_t lastRow;
+    uint32_t lastColumn;
+};
+
+// A comment for the cell at a 1-based row and column.
+struct CellComment {
+    uint32_t row;
+    uint32_t column;
+    std::string text;
+};
+
 class ExcelOperator {
 public:
+    using RowVisitor = std::function<void(uint32_t rowNumber, const std::vector<OpenXLSX::XLCellValue>& values)>;
+    // Fills values with the next row to write and returns true, or returns false once there are no more rows.
+    using RowSource = std::function<bool(std::vector<OpenXLSX::XLCellValue>& values)>;
+
     ExcelOperator();
     ~ExcelOperator();
 
@@ -28,6 +62,7 @@ public:
     bool deleteSheet(const std::string& sheetName);
     bool renameSheet(const std::string& oldName, const std::string& newName);
     uint32_t sheetCount() const;
+    std::vector<std::string> sheetNames() const;
     std::string currentSheetName() const;
 
     template<typename T>
@@ -38,6 +73,9 @@ public:
 
     bool clearCell(uint32_t row, uint32_t column);
     bool mergeCells(uint32_t firstRow, uint32_t firstColumn, uint32_t lastRow, uint32_t lastColumn);
+    // Merges all ranges at once. If a range is invalid or overlaps an existing merge or another range, nothing is merged
+    // and OpenXLSX::XLInputError is thrown.
+    bool mergeCells(const std::vector<CellRange>& ranges);
     bool unmergeCells(uint32_t firstRow, uint32_t firstColumn, uint32_t lastRow, uint32_t lastColumn);
 
     bool setCellFontColor(uint32_t row, uint32_t column, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha = 255);
@@ -48,10 +86,23 @@ public:
     bool setCellFontUnderline(uint32_t row, uint32_t column, bool underline);
     bool setCellAlignment(uint32_t row, uint32_t column, const std::string& horizontal, const std::string& vertical);
 
+    // Applies style to every cell in the range. One new cell format is derived per distinct format found in the range,
+    // and fonts, fills and cell formats that already exist with the same content are reused.
+    bool setRangeStyle(uint32_t firstRow, uint32_t firstColumn, uint32_t lastRow, uint32_t lastColumn, const CellStyle& style);
+
+    // Sets all comments in one pass over the selected sheet's comment list, replacing existing comments of the same
+    // cells, and attributes them to author, which is added to the sheet's comment authors if needed. If a cell is
+    // outside the sheet, no comment is set and OpenXLSX::XLCellAddressError is thrown.
+    bool setComments(const std::vector<CellComment>& comments, const std::string& author);
+
     bool setColumnWidth(uint32_t column, double width);
     bool setRowHeight(uint32_t row, double height);
     uint32_t columnCount() const;
     uint32_t rowCount() const;
+    // Gets the smallest range that contains all cells of the selected sheet. The worksheet keeps it up to date as cells are
+    // added, so the sheet is not scanned; for a sheet that has not been loaded, only the start of its XML is read.
+    // Returns false if the sheet has no cells.
+    bool usedRange(CellRange& range);
 
     template<typename T>
     bool setRowData(uint32_t rowNumber, const std::vector<T>& data);
@@ -65,14 +116,37 @@ public:
     template<typename T>
     std::vector<T> getColumnData(uint16_t columnNumber);
 
+    // Calls visitor once for every row in [firstRow, lastRow] that exists in the sheet, in ascending order, with the
+    // values of columns [firstColumn, lastColumn]. Missing rows are skipped and nothing is created in the sheet.
+    // If the sheet's XML document has not been built, the rows are streamed from the archive up to lastRow instead.
+    bool visitRangeRows(uint32_t firstRow, uint32_t firstColumn, uint32_t lastRow, uint32_t lastColumn, const RowVisitor& visitor);
+
+    // Reads the values of the range into contiguous per-column buffers of doubles, integers or strings with validity
+    // bitmaps (see OpenXLSX::XLColumnarRange), in a single pass over the sheet XML and without an XLCellValue per cell.
+    bool getRangeColumns(uint32_t firstRow, uint32_t firstColumn, uint32_t lastRow, uint32_t lastColumn, OpenXLSX::XLColumnarRange& columns);
+
     std::vector<std::vector<OpenXLSX::XLCellValue>> getRangeValues(uint32_t firstRow, uint32_t firstColumn, uint32_t lastRow, uint32_t lastColumn);
 
     bool setRangeValues(uint32_t firstRow, uint32_t firstColumn, const std::vector<std::vector<XLCellValue>>& values);
 
+    // Replaces the rows of sheetName, which is added if it does not exist, by the rows produced by source, starting at
+    // row 1. The rows are compressed into the workbook as they are produced rather than built as XML nodes, so memory
+    // use does not grow with the number of rows. rowCount receives the number of rows written.
+    bool writeSheetRows(const std::string& sheetName, const RowSource& source, uint32_t& rowCount);
+
 private:
+    OpenXLSX::XLStyleIndex deriveCellFormat(OpenXLSX::XLStyleIndex sourceFormatIndex, const CellStyle& style);
+
+    // Returns the selected worksheet, building its XML document on first use.
+    OpenXLSX::XLWorksheet& currentSheet() const;
+
     OpenXLSX::XLDocument m_document;
     OpenXLSX::XLWorkbook m_workbook;
-    OpenXLSX::XLWorksheet m_currentSheet;
+    std::string m_currentSheetName;
+    // The selected worksheet is only materialized when an operation needs its XML document, so that reading a sheet
+    // whose XML document was never built can stream it from the archive instead (see visitRangeRows).
+    mutable std::optional<OpenXLSX::XLWorksheet> m_currentSheet;
+    mutable std::unordered_set<std::string> m_loadedSheets; // Worksheets whose XML document has been built
     bool m_isOpen;
 };
 
@@ -83,7 +157,7 @@ void ExcelWrapper::ExcelOperator::setCellValue(const std::string& cellReference,
     if (!m_isOpen) {
         return;
     }
-    m_currentSheet.cell(cellReference).value() = value;
+    currentSheet().cell(cellReference).value() = value;
 }
 
 template<typename T>
@@ -91,7 +165,7 @@ T ExcelWrapper::ExcelOperator::getCellValue(const std::string& cellReference) {
     if (!m_isOpen) {
         return T();
     }
-    return m_currentSheet.cell(cellReference).value().get<T>();
+    return currentSheet().cell(cellReference).value().get<T>();
 }
 
 template<typename T>
@@ -100,7 +174,7 @@ bool ExcelWrapper::ExcelOperator::setRowData(uint32_t rowNumber, const std::vect
         return false;
     }
     for (size_t i = 0; i < data.size(); ++i) {
-        m_currentSheet.cell(rowNumber, static_cast<uint16_t>(i + 1)).value() = data[i];
+        currentSheet().cell(rowNumber, static_cast<uint16_t>(i + 1)).value() = data[i];
     }
     return true;
 }
@@ -112,7 +186,7 @@ std::vector<T> ExcelWrapper::ExcelOperator::getRowData(uint32_t rowNumber) {
         return rowData;
     }
     for (uint16_t col = 1; col <= 100; ++col) {
-        OpenXLSX::XLCell cell = m_currentSheet.cell(rowNumber, col);
+        OpenXLSX::XLCell cell = currentSheet().cell(rowNumber, col);
         if (!cell) {
             break;
         }
@@ -130,7 +204,7 @@ void ExcelWrapper::ExcelOperator::setColumnData(uint16_t columnNumber, const std
         return;
     }
     for (size_t i = 0; i < data.size(); ++i) {
-        m_currentSheet.cell(static_cast<uint32_t>(i + 1), columnNumber).value() = data[i];
+        currentSheet().cell(static_cast<uint32_t>(i + 1), columnNumber).value() = data[i];
     }
 }
 
@@ -141,7 +215,7 @@ std::vector<T> ExcelWrapper::ExcelOperator::getColumnData(uint16_t columnNumber)
         return columnData;
     }
     for (uint32_t row = 1; row <= 100; ++row) {
-        OpenXLSX::XLCell cell = m_currentSheet.findCell(row, columnNumber);
+        OpenXLSX::XLCell cell = currentSheet().findCell(row, columnNumber);
         if (!cell) {
             break;
         }
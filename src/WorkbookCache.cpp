@@ -0,0 +1,181 @@
+#include "WorkbookCache.h"
+
+#include <system_error>
+
+namespace ExcelWrapper {
+
+// Rough ratio between the in-memory size of a parsed workbook and its compressed size on disk.
+static const uint64_t FOOTPRINT_EXPANSION = 10;
+
+WorkbookCache::WorkbookCache(uint64_t memoryBudget) : m_memoryBudget(memoryBudget), m_memoryUsage(0) {
+}
+
+WorkbookCache::~WorkbookCache() {
+    try {
+        evictAll();
+    } catch (const std::exception&) {
+        // Nothing can be reported this late; the files keep their last committed contents.
+    }
+}
+
+ExcelOperator& WorkbookCache::acquire(const std::string& filePath) {
+    std::string key = normalizePath(filePath);
+
+    auto found = m_index.find(key);
+    if (found != m_index.end()) {
+        if (!isStale(*found->second)) {
+            m_entries.splice(m_entries.begin(), m_entries, found->second);
+            return *m_entries.front().excel;
+        }
+        // Neither copy can be preferred silently: re-opening would drop the changes, keeping them would overwrite the file
+        if (found->second->dirty) {
+            throw StaleWorkbookError(key + " was modified on disk while it has uncommitted changes");
+        }
+        erase(found->second);
+    }
+
+    auto excel = std::make_unique<ExcelOperator>();
+    std::vector<std::string> sheetNames;
+    excel->open(key, sheetNames);
+
+    m_entries.push_front(Entry{key, {}, 0, 0, false, std::move(excel)});
+    m_index[key] = m_entries.begin();
+    stamp(m_entries.front());
+    enforceBudget();
+    return *m_entries.front().excel;
+}
+
+ExcelOperator& WorkbookCache::create(const std::string& filePath) {
+    std::string key = normalizePath(filePath);
+    evict(key);
+
+    auto excel = std::make_unique<ExcelOperator>();
+    excel->create(key);
+
+    m_entries.push_front(Entry{key, {}, 0, 0, false, std::move(excel)});
+    m_index[key] = m_entries.begin();
+    stamp(m_entries.front());
+    enforceBudget();
+    return *m_entries.front().excel;
+}
+
+void WorkbookCache::markDirty(const std::string& filePath) {
+    auto found = m_index.find(normalizePath(filePath));
+    if (found != m_index.end()) {
+        found->second->dirty = true;
+    }
+}
+
+bool WorkbookCache::commit(const std::string& filePath) {
+    auto found = m_index.find(normalizePath(filePath));
+    if (found == m_index.end()) {
+        return false;
+    }
+    if (found->second->dirty) {
+        save(*found->second);
+        enforceBudget();
+    }
+    return true;
+}
+
+bool WorkbookCache::evict(const std::string& filePath) {
+    auto found = m_index.find(normalizePath(filePath));
+    if (found == m_index.end()) {
+        return false;
+    }
+    erase(found->second);
+    return true;
+}
+
+bool WorkbookCache::discard(const std::string& filePath) {
+    auto found = m_index.find(normalizePath(filePath));
+    if (found == m_index.end()) {
+        return false;
+    }
+    erase(found->second, false);
+    return true;
+}
+
+size_t WorkbookCache::evictAll() {
+    size_t count = m_entries.size();
+    while (!m_entries.empty()) {
+        erase(m_entries.begin());
+    }
+    return count;
+}
+
+size_t WorkbookCache::size() const {
+    return m_entries.size();
+}
+
+uint64_t WorkbookCache::memoryUsage() const {
+    return m_memoryUsage;
+}
+
+uint64_t WorkbookCache::memoryBudget() const {
+    return m_memoryBudget;
+}
+
+std::mutex& WorkbookCache::mutex() {
+    return m_mutex;
+}
+
+std::string WorkbookCache::normalizePath(const std::string& filePath) {
+    std::error_code ec;
+    std::filesystem::path absolute = std::filesystem::absolute(filePath, ec);
+    if (ec) {
+        return filePath;
+    }
+    return absolute.lexically_normal().string();
+}
+
+bool WorkbookCache::isStale(const Entry& entry) {
+    std::error_code ec;
+    auto modifiedTime = std::filesystem::last_write_time(entry.path, ec);
+    if (ec) {
+        return true;
+    }
+    auto fileSize = std::filesystem::file_size(entry.path, ec);
+    if (ec) {
+        return true;
+    }
+    return modifiedTime != entry.modifiedTime || fileSize != entry.fileSize;
+}
+
+void WorkbookCache::stamp(Entry& entry) {
+    std::error_code ec;
+    entry.modifiedTime = std::filesystem::last_write_time(entry.path, ec);
+    entry.fileSize = std::filesystem::file_size(entry.path, ec);
+    if (ec) {
+        entry.fileSize = 0;
+    }
+
+    m_memoryUsage -= entry.footprint;
+    entry.footprint = static_cast<uint64_t>(entry.fileSize) * FOOTPRINT_EXPANSION;
+    m_memoryUsage += entry.footprint;
+}
+
+void WorkbookCache::save(Entry& entry) {
+    entry.excel->save();
+    entry.dirty = false;
+    stamp(entry);
+}
+
+void WorkbookCache::erase(EntryList::iterator it, bool saveChanges) {
+    if (saveChanges && it->dirty) {
+        save(*it);
+    }
+    it->excel->close();
+    m_memoryUsage -= it->footprint;
+    m_index.erase(it->path);
+    m_entries.erase(it);
+}
+
+void WorkbookCache::enforceBudget() {
+    // The most recently used workbook is kept even if it alone exceeds the budget.
+    while (m_memoryUsage > m_memoryBudget && m_entries.size() > 1) {
+        erase(std::prev(m_entries.end()));
+    }
+}
+
+} // namespace ExcelWrapper
@@ -0,0 +1,95 @@
+#ifndef WORKBOOK_CACHE_H
+#define WORKBOOK_CACHE_H
+
+#include <string>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <mutex>
+#include <cstdint>
+#include <filesystem>
+#include <unordered_map>
+
+#include "ExcelOperator.h"
+
+namespace ExcelWrapper {
+
+// Thrown by WorkbookCache::acquire when the file of a workbook with uncommitted changes was modified on disk.
+class StaleWorkbookError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+// Keeps parsed workbooks resident between tool calls so that repeated requests against the same
+// file do not pay for unzipping and parsing it again. Entries are keyed by absolute path and are
+// invalidated when the file's modification time or size changes on disk. When the estimated memory
+// footprint of all resident workbooks exceeds the budget, the least recently used ones are closed.
+// Modifications are kept in memory until commit(), and are committed before the workbook is closed by
+// evict(), evictAll() or the budget (including on destruction). They are lost if the process is killed.
+// A workbook with uncommitted changes whose file changed on disk is not replaced: acquire() throws
+// StaleWorkbookError until it is committed or discarded.
+// All member functions expect the caller to hold mutex() for the duration of the operation.
+class WorkbookCache {
+public:
+    explicit WorkbookCache(uint64_t memoryBudget);
+    ~WorkbookCache();
+
+    WorkbookCache(const WorkbookCache&) = delete;
+    WorkbookCache& operator=(const WorkbookCache&) = delete;
+
+    // Returns the resident workbook for filePath, opening (or re-opening a stale copy of) it if needed. Throws
+    // StaleWorkbookError if the resident copy is stale but has uncommitted changes.
+    ExcelOperator& acquire(const std::string& filePath);
+
+    // Creates a new workbook at filePath, replacing any resident copy, and keeps it resident.
+    ExcelOperator& create(const std::string& filePath);
+
+    // Records that the resident workbook for filePath has changes that are not saved yet.
+    void markDirty(const std::string& filePath);
+
+    // Saves the resident workbook for filePath if it has uncommitted changes. Returns false if it was not resident.
+    bool commit(const std::string& filePath);
+
+    // Closes the resident workbook for filePath. Returns false if it was not resident.
+    bool evict(const std::string& filePath);
+
+    // Closes the resident workbook for filePath without saving uncommitted changes.
+    bool discard(const std::string& filePath);
+
+    // Closes all resident workbooks and returns how many were released.
+    size_t evictAll();
+
+    size_t size() const;
+    uint64_t memoryUsage() const;
+    uint64_t memoryBudget() const;
+
+    std::mutex& mutex();
+
+private:
+    struct Entry {
+        std::string path;
+        std::filesystem::file_time_type modifiedTime;
+        uintmax_t fileSize;
+        uint64_t footprint;
+        bool dirty;
+        std::unique_ptr<ExcelOperator> excel;
+    };
+    using EntryList = std::list<Entry>;
+
+    static std::string normalizePath(const std::string& filePath);
+    static bool isStale(const Entry& entry);
+    void stamp(Entry& entry);
+    void save(Entry& entry);
+    void erase(EntryList::iterator it, bool saveChanges = true);
+    void enforceBudget();
+
+    EntryList m_entries; // Most recently used first
+    std::unordered_map<std::string, EntryList::iterator> m_index;
+    uint64_t m_memoryBudget;
+    uint64_t m_memoryUsage;
+    std::mutex m_mutex;
+};
+
+} // namespace ExcelWrapper
+
+#endif // WORKBOOK_CACHE_H
@@ -13,17 +13,33 @@ const char* EN_JSON = R"json(
       "failed_open_or_list": "Failed to open Excel file or list sheets: {0}",
       "missing_params": {
         "get_range": "Missing required parameters for get_sheet_range_content.",
+        "get_used_range": "Missing 'sheet_name' parameter for get_sheet_used_range.",
         "create_xlsx": "Missing 'file_path' parameter for create_xlsx_file.",
-        "set_range": "Missing required parameters for set_sheet_range_content."
+        "set_range": "Missing required parameters for set_sheet_range_content.",
+        "bulk_write": "Missing required parameters for bulk_write_sheet_content.",
+        "set_comments": "Missing required parameters for set_sheet_range_comments.",
+        "flush_discard": "Missing 'file_path' parameter for flush_workbook_cache with discard_changes."
       },
       "failed_select_sheet": "Failed to select sheet: {0}",
       "values_not_2d_array": "'values' parameter must be a 2D array for set_sheet_range_content.",
       "values_row_not_array": "Each row in 'values' must be an array for set_sheet_range_content.",
+      "comments_not_2d_array": "'comments' parameter must be a 2D array of strings or nulls for set_sheet_range_comments.",
+      "comment_out_of_sheet": "Comment for row {0}, column {1} is outside the sheet for set_sheet_range_comments.",
       "unsupported_cell_type": {
          "set_range": "Unsupported cell value type in 'values' array for set_sheet_range_content."
       },
       "failed_create_excel": "Failed to create Excel file: {0}",
-      "failed_set_range": "Failed to set sheet range content for sheet: {0}"
+      "failed_set_range": "Failed to set sheet range content for sheet: {0}",
+      "failed_open_csv": "Failed to open CSV file: {0}",
+      "failed_bulk_write": "Failed to write rows to sheet: {0}",
+      "failed_set_comments": "Failed to set comments for sheet: {0}",
+      "failed_commit": "Failed to save workbook: {0}",
+      "stale_workbook": "Workbook changed on disk while it has uncommitted changes: {0}",
+      "commit_not_open": "Workbook to commit is not open: {0}",
+      "range_out_of_sheet": "Values starting at row {0}, column {1} with {2} row(s) and {3} column(s) extend beyond the sheet for set_sheet_range_content.",
+      "bulk_write_too_many_rows": "More than {0} rows given for bulk_write_sheet_content.",
+      "bulk_write_too_many_columns": "Row {0} has {1} values, more than the {2} columns of a sheet, for bulk_write_sheet_content.",
+      "write_failed_changes_dropped": "Failed to write to sheet {0}: {1}. Dropped uncommitted changes of workbook: {2}"
     },
     "warn": {
        "unsupported_cell_type": {
@@ -34,9 +50,15 @@ const char* EN_JSON = R"json(
     "info": {
       "opened_excel": "Successfully opened Excel file: {0}",
       "retrieved_range": "Successfully retrieved sheet range content from sheet: {0}",
+      "retrieved_used_range": "Successfully retrieved used range of sheet: {0}",
       "created_excel": "Successfully created Excel file: {0}",
       "set_range": "Successfully set sheet range content for sheet: {0}",
+      "bulk_written": "Wrote {0} row(s) to sheet: {1}",
+      "set_comments": "Set {0} comment(s) in sheet: {1}",
+      "committed": "Saved pending changes of workbook: {0}",
+      "flushed_cache": "Released {0} cached workbook(s)",
       "server_start": "Starting MCP server at localhost:{0}",
+      "server_start_stdio": "Starting MCP server on stdio",
       "server_stop_prompt": "Press Ctrl+C to stop the server"
     }
   },
@@ -51,16 +73,32 @@ const char* EN_JSON = R"json(
       "failed_open_or_list": "Failed to open Excel file or list sheets: {0}",
       "missing_params": {
          "get_range": "Missing required parameters for sheet range content.",
-         "set_range": "Missing required parameters for setting sheet range content."
+         "get_used_range": "Missing 'sheet_name' parameter.",
+         "set_range": "Missing required parameters for setting sheet range content.",
+         "bulk_write": "'sheet_name' and exactly one of 'csv', 'csv_file_path' or 'values' are required.",
+         "set_comments": "Missing required parameters for setting sheet range comments.",
+         "flush_discard": "'discard_changes' requires 'file_path'."
       },
       "failed_select_sheet": "Failed to select sheet: {0}",
       "failed_create_excel": "Failed to create Excel file: {0}",
       "values_not_2d_array": "'values' parameter must be a 2D array.",
       "values_row_not_array": "Each row in 'values' must be an array.",
+      "comments_not_2d_array": "'comments' parameter must be a 2D array of strings or nulls.",
+      "comment_out_of_sheet": "Comment for row {0}, column {1} is outside the sheet.",
       "unsupported_cell_type": {
          "set_range": "Unsupported cell value type in 'values' array."
       },
-      "failed_set_range": "Failed to set sheet range content."
+      "failed_set_range": "Failed to set sheet range content.",
+      "failed_open_csv": "Failed to open CSV file: {0}",
+      "failed_bulk_write": "Failed to write rows to sheet: {0}",
+      "failed_set_comments": "Failed to set comments for sheet: {0}",
+      "failed_commit": "Failed to save workbook: {0}",
+      "stale_workbook": "{0} was changed on disk while it has uncommitted changes made through this server. Call 'commit_workbook' to overwrite the file with them, or 'flush_workbook_cache' with this file_path and 'discard_changes' set to true to drop them and read the file again.",
+      "commit_not_open": "Nothing was saved: {0} is not open in this server, so it has no pending changes. Open it with 'open_excel_and_list_sheets' before editing and committing it.",
+      "range_out_of_sheet": "Values starting at row {0}, column {1} with {2} row(s) and {3} column(s) extend beyond the sheet.",
+      "bulk_write_too_many_rows": "A sheet holds at most {0} rows.",
+      "bulk_write_too_many_columns": "Row {0} has {1} values, but a sheet holds at most {2} columns.",
+      "write_failed_changes_dropped": "Failed to write to sheet '{0}': {1}. The sheet may have been written in part, so all uncommitted changes to {2} were dropped and the file will be read again from disk. Repeat those changes before calling 'commit_workbook'."
     }
   },
   "tool": {
@@ -81,8 +119,14 @@ const char* EN_JSON = R"json(
         "cell_with_coord": "Output non-empty cells with their respective coordinates, suitable for situations where the output area contains a large number of empty cells"
       }
     },
+    "get_used_range": {
+      "description": "Get the used range of a specific sheet, i.e. the smallest range that contains all of its cells. Answers instantly regardless of the size of the sheet, so use it to find out which range to read with 'get_sheet_range_content'.",
+      "param": {
+        "sheet_name": "The name of the sheet to inspect"
+      }
+    },
     "set_range": {
-      "description": "Set table content within a specified range in a specific sheet. Automatically opens and closes the Excel file.",
+      "description": "Set table content within a specified range in a specific sheet. Changes are kept in memory until 'commit_workbook' is called; uncommitted changes are saved when the server shuts down normally, but are lost if it is interrupted or killed.",
       "param": {
         "sheet_name": "The name of the sheet to write to",
         "first_row": "The starting row number (1-indexed)",
@@ -90,16 +134,54 @@ const char* EN_JSON = R"json(
         "values": "The 2D array of values to write to the range"
       }
     },
+    "bulk_write": {
+      "description": "Replace the content of a sheet with rows from CSV text, a CSV file or a 2D array, starting at cell A1. The sheet is created if it does not exist. Suited to writing large tables, which are compressed as they are written. Unquoted CSV fields that are numbers or TRUE/FALSE are written as numbers and booleans. Changes are kept in memory until 'commit_workbook' is called; uncommitted changes are saved when the server shuts down normally, but are lost if it is interrupted or killed.",
+      "param": {
+        "sheet_name": "The name of the sheet to write to",
+        "csv": "CSV text with the rows to write",
+        "csv_file_path": "The path of a CSV file with the rows to write",
+        "values": "The 2D array of values to write"
+      }
+    },
+    "set_comments": {
+      "description": "Set the comments (notes) of the cells in a range of a specific sheet in one request, replacing existing comments of the same cells. Changes are kept in memory until 'commit_workbook' is called; uncommitted changes are saved when the server shuts down normally, but are lost if it is interrupted or killed.",
+      "param": {
+        "sheet_name": "The name of the sheet to annotate",
+        "first_row": "The starting row number (1-indexed)",
+        "first_column": "The starting column number (1-indexed)",
+        "comments": "The 2D array of comment texts for the range. Use null for cells whose comment should stay unchanged",
+        "author": "The author of the comments. Defaults to 'ExcelAutoCpp'"
+      }
+    },
     "create_xlsx": {
       "description": "Create a new xlsx file with the given path. Automatically closes the Excel file after creation.",
       "param": {
         "file_path": "The ABSOLUTE path with which the file should create to"
       }
+    },
+    "commit": {
+      "description": "Save all pending changes of a workbook to disk. Changes made by 'set_sheet_range_content', 'bulk_write_sheet_content' and 'set_sheet_range_comments' are kept in memory and not written to the file until this tool is called, and are lost if the server is interrupted or killed before that. If the file was changed on disk while it had pending changes, this overwrites it with the workbook in memory.",
+      "param": {
+        "file_path": "The path of the workbook to save. Leave empty to save the current Excel file"
+      }
+    },
+    "flush_cache": {
+      "description": "Release workbooks that are kept open in memory between tool calls, saving their pending changes first unless 'discard_changes' is set. Use this after editing a file outside this server or to free memory. A file that was changed on disk while it had pending changes can not be used until it is released with 'discard_changes' (keeping the file on disk) or saved with 'commit_workbook' (keeping the changes).",
+      "param": {
+        "file_path": "The path of the workbook to release. Leave empty to release all cached workbooks",
+        "discard_changes": "Drop the pending changes of the workbook instead of saving them. Requires 'file_path'"
+      }
     }
   },
   "result": {
     "created_excel": "Excel file created successfully: {0}",
-    "set_range": "Successfully set sheet range content.",
+    "used_range": "Sheet '{0}' uses range {1}: rows {2} to {4}, columns {3} to {5}.",
+    "used_range_empty": "Sheet '{0}' has no cells.",
+    "set_range": "Successfully set sheet range content. Call 'commit_workbook' to save it to disk.",
+    "bulk_written": "Wrote {0} row(s) to sheet '{1}'. Call 'commit_workbook' to save it to disk.",
+    "set_comments": "Set {0} comment(s) in sheet '{1}'. Call 'commit_workbook' to save it to disk.",
+    "committed": "Saved pending changes to {0}.",
+    "flushed_cache": "Released {0} cached workbook(s).",
     "unsupported_type": "[Unsupported Type]",
     "invalid_address": "InvalidAddress"
   }
@@ -1,7 +1,7 @@
 #include "i18n.h"
 #include <fstream>
-#include <sstream>
-#include <iostream> // For std::cerr in case spdlog is not yet initialized
+#include <iterator>
+#include "json.hpp" // nlohmann/json, only needed to parse language documents
 #include "spdlog/spdlog.h" // For logging errors
 
 namespace i18n {
@@ -17,14 +17,12 @@ bool I18nManager::loadLanguage(const std::string& langCode, const std::string& f
     std::ifstream fileStream(filePath);
     if (!fileStream.is_open()) {
         spdlog::error("i18n: Failed to open language file: {}", filePath);
-        // Fallback to cerr if spdlog might not be ready
-        // std::cerr << "i18n: Failed to open language file: " << filePath << std::endl;
         return false;
     }
 
+    std::string jsonContent((std::istreambuf_iterator<char>(fileStream)), std::istreambuf_iterator<char>());
     try {
-        nlohmann::json langData = nlohmann::json::parse(fileStream);
-        languages_[langCode] = langData;
+        addLanguage(langCode, jsonContent);
         spdlog::info("i18n: Successfully loaded language file '{}' for language code '{}'", filePath, langCode);
         // Set the first loaded language as the default/current one if none is set
         if (currentLangCode_.empty()) {
@@ -33,11 +31,9 @@ bool I18nManager::loadLanguage(const std::string& langCode, const std::string& f
         return true;
     } catch (const nlohmann::json::parse_error& e) {
         spdlog::error("i18n: Failed to parse language file '{}': {}", filePath, e.what());
-        // std::cerr << "i18n: Failed to parse language file '" << filePath << "': " << e.what() << std::endl;
         return false;
     } catch (const std::exception& e) {
         spdlog::error("i18n: An unexpected error occurred while loading language file '{}': {}", filePath, e.what());
-        // std::cerr << "i18n: An unexpected error occurred while loading language file '" << filePath << "': " << e.what() << std::endl;
         return false;
     }
 }
@@ -45,8 +41,7 @@ bool I18nManager::loadLanguage(const std::string& langCode, const std::string& f
 // Load language data from a JSON string
 bool I18nManager::loadLanguageFromString(const std::string& langCode, const std::string& jsonContent) {
     try {
-        nlohmann::json langData = nlohmann::json::parse(jsonContent);
-        languages_[langCode] = langData;
+        addLanguage(langCode, jsonContent);
         spdlog::info("i18n: Successfully loaded language string for language code '{}'", langCode);
         // Set the first loaded language as the default/current one if none is set
         if (currentLangCode_.empty()) {
@@ -62,11 +57,71 @@ bool I18nManager::loadLanguageFromString(const std::string& langCode, const std:
     }
 }
 
+// Parse a language document and flatten it into a table keyed by dotted path. Values that are not strings are skipped.
+void I18nManager::addLanguage(const std::string& langCode, const std::string& jsonContent) {
+    nlohmann::json document = nlohmann::json::parse(jsonContent);
+
+    Language language;
+    std::vector<std::pair<std::string, const nlohmann::json*>> pending{{std::string(), &document}};
+    while (!pending.empty()) {
+        auto [prefix, node] = std::move(pending.back());
+        pending.pop_back();
+        for (auto it = node->begin(); node->is_object() && it != node->end(); ++it) {
+            std::string key = prefix.empty() ? it.key() : prefix + "." + it.key();
+            if (it->is_object()) {
+                pending.emplace_back(std::move(key), &*it);
+                continue;
+            }
+            if (!it->is_string()) {
+                continue;
+            }
+
+            Translation translation{it->get<std::string>(), {}};
+            translation.pieces = parse(translation.text);
+
+            const std::string& storedKey = language.keys.emplace_back(std::move(key));
+            language.table.emplace(storedKey, std::move(translation));
+        }
+    }
+
+    languages_[langCode] = std::move(language);
+    if (langCode == currentLangCode_) {
+        currentLanguage_ = &languages_[langCode];
+    }
+}
+
+// Split a translation into runs of literal text and {n} placeholders
+std::vector<I18nManager::Piece> I18nManager::parse(const std::string& text) {
+    std::vector<Piece> pieces;
+    size_t literal = 0;
+    for (size_t open = text.find('{'); open != std::string::npos; open = text.find('{', open + 1)) {
+        size_t close = open + 1;
+        while (close < text.size() && text[close] >= '0' && text[close] <= '9') {
+            ++close;
+        }
+        if (close == open + 1 || close >= text.size() || text[close] != '}') {
+            continue;
+        }
+        int index = 0;
+        std::from_chars(text.data() + open + 1, text.data() + close, index);
+        if (open > literal) {
+            pieces.push_back({literal, open - literal, -1});
+        }
+        pieces.push_back({open, close + 1 - open, index});
+        literal = close + 1;
+    }
+    if (literal < text.size()) {
+        pieces.push_back({literal, text.size() - literal, -1});
+    }
+    return pieces;
+}
 
 // Set the current language
 bool I18nManager::setLanguage(const std::string& langCode) {
-    if (languages_.count(langCode)) {
+    auto found = languages_.find(langCode);
+    if (found != languages_.end()) {
         currentLangCode_ = langCode;
+        currentLanguage_ = &found->second;
         spdlog::info("i18n: Set current language to '{}'", langCode);
         return true;
     } else {
@@ -75,43 +130,43 @@ bool I18nManager::setLanguage(const std::string& langCode) {
     }
 }
 
-// Get the translation for a key
-std::string I18nManager::get(const std::string& key) const {
-    if (currentLangCode_.empty() || languages_.find(currentLangCode_) == languages_.end()) {
+// Look up the translation for a key in the current language
+const I18nManager::Translation* I18nManager::find(std::string_view key) const {
+    if (currentLanguage_ == nullptr) {
         spdlog::warn("i18n: No language set or current language '{}' not loaded. Returning key '{}'.", currentLangCode_, key);
-        return key; // Return the key itself if no language is set or loaded
+        return nullptr;
     }
+    auto found = currentLanguage_->table.find(key);
+    if (found == currentLanguage_->table.end()) {
+        spdlog::warn("i18n: Translation key '{}' not found in language '{}'.", key, currentLangCode_);
+        return nullptr;
+    }
+    return &found->second;
+}
 
-    const auto& langData = languages_.at(currentLangCode_);
-    try {
-        // Navigate nested keys if necessary (e.g., "errors.file_not_found")
-        nlohmann::json current = langData;
-        std::string segment;
-        std::stringstream ss(key);
-        bool first = true;
-        while (std::getline(ss, segment, '.')) {
-            if (!current.contains(segment)) {
-                 spdlog::warn("i18n: Translation key '{}' not found in language '{}'.", key, currentLangCode_);
-                 return key; // Return the original key if not found
-            }
-            current = current[segment];
-            first = false;
-        }
+// Get the translation for a key
+std::string I18nManager::get(std::string_view key) const {
+    const Translation* translation = find(key);
+    return translation != nullptr ? translation->text : std::string(key);
+}
 
+// Replace the placeholders of a translation with the arguments in a single pass
+std::string I18nManager::format(const Translation& translation, const Argument* arguments, size_t count) {
+    size_t length = translation.text.size();
+    for (size_t i = 0; i < count; ++i) {
+        length += arguments[i].view().size();
+    }
 
-        if (current.is_string()) {
-            return current.get<std::string>();
+    std::string result;
+    result.reserve(length);
+    for (const Piece& piece : translation.pieces) {
+        if (piece.argument >= 0 && static_cast<size_t>(piece.argument) < count) {
+            result.append(arguments[piece.argument].view());
         } else {
-             spdlog::warn("i18n: Translation key '{}' in language '{}' is not a string.", key, currentLangCode_);
-            return key; // Return key if the found value isn't a string
+            result.append(translation.text, piece.offset, piece.length);
         }
-    } catch (const nlohmann::json::exception& e) {
-        spdlog::warn("i18n: Error accessing translation key '{}' in language '{}': {}", key, currentLangCode_, e.what());
-        return key; // Return the key in case of JSON access errors
-    } catch (const std::exception& e) {
-         spdlog::error("i18n: Unexpected error getting translation for key '{}' in language '{}': {}", key, currentLangCode_, e.what());
-         return key;
     }
+    return result;
 }
 
 // Get the current language code
@@ -119,6 +174,4 @@ const std::string& I18nManager::getCurrentLanguage() const {
     return currentLangCode_;
 }
 
-// Note: The template format functions are defined inline in the header (i18n.h)
-
-} // namespace i18n
\ No newline at end of file
+} // namespace i18n
@@ -1,17 +1,48 @@
 #ifndef I18N_H
 #define I18N_H
 
+#include <array>
+#include <charconv>
+#include <deque>
 #include <string>
-#include <vector>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
-#include <sstream> // Added for std::stringstream
-#include "json.hpp" // Corrected include path for nlohmann/json
-
-// Use the correct namespace for the JSON library
-namespace nlohmann { using json = basic_json<>; }
+#include <vector>
 
 namespace i18n {
 
+// A formatting argument, converted to text once before the translation is formatted.
+// Strings are referenced rather than copied; numbers are formatted into the argument itself.
+class Argument {
+public:
+    Argument(const std::string& value) : view_(value) {}
+    Argument(std::string_view value) : view_(value) {}
+    Argument(const char* value) : view_(value ? value : "") {}
+    Argument(char value) : buffer_{value}, view_(buffer_, 1) {}
+    Argument(bool value) : view_(value ? "1" : "0") {}
+
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    Argument(T value) {
+        auto result = std::to_chars(buffer_, buffer_ + sizeof(buffer_), value);
+        view_ = std::string_view(buffer_, static_cast<size_t>(result.ptr - buffer_));
+    }
+
+    // The view may point into the argument itself, so it must not be copied.
+    Argument(const Argument&) = delete;
+    Argument& operator=(const Argument&) = delete;
+
+    std::string_view view() const { return view_; }
+
+private:
+    char buffer_[32];
+    std::string_view view_;
+};
+
+// Languages are flattened when they are loaded: every string in the (nested) language document is stored under its
+// dotted path, e.g. "log.error.no_excel_path", with the positions of its {0}, {1}, ... placeholders already parsed.
+// A lookup is a single hash table probe and formatting is a single pass over the parsed pieces, without any shared
+// state. Languages must be loaded and selected before translations are requested from several threads.
 class I18nManager {
 public:
     // Loads language data from a JSON file.
@@ -28,14 +59,18 @@ public:
 
     // Gets the translation for a given key in the current language.
     // Returns the key itself if the translation is not found.
-    std::string get(const std::string& key) const;
+    std::string get(std::string_view key) const;
 
     // Gets the translation for a given key and formats it with arguments.
-    // Uses simple placeholder replacement like {0}, {1}, etc.
+    // Every {0}, {1}, etc. is replaced with the corresponding argument; placeholders without an argument are kept.
     template<typename... Args>
-    std::string get(const std::string& key, Args&&... args) const {
-        std::string formatString = get(key);
-        return format(formatString, std::forward<Args>(args)...);
+    std::string get(std::string_view key, Args&&... args) const {
+        const Translation* translation = find(key);
+        if (translation == nullptr) {
+            return std::string(key);
+        }
+        const std::array<Argument, sizeof...(Args)> arguments{Argument(std::forward<Args>(args))...};
+        return format(*translation, arguments.data(), arguments.size());
     }
 
     // Returns the currently set language code.
@@ -50,44 +85,45 @@ private:
     I18nManager(const I18nManager&) = delete;
     I18nManager& operator=(const I18nManager&) = delete;
 
-    // Helper function for string formatting.
-    template<typename T, typename... Args>
-    std::string format(std::string formatString, T&& value, Args&&... args) const {
-        size_t pos = formatString.find("{" + std::to_string(placeholderIndex++) + "}");
-        if (pos != std::string::npos) {
-            std::stringstream ss;
-            ss << value;
-            formatString.replace(pos, 3 + std::to_string(placeholderIndex - 1).length(), ss.str());
-            return format(formatString, std::forward<Args>(args)...);
-        }
-        // Reset index if we still have arguments but no more placeholders
-        placeholderIndex = 0;
-        return formatString; // Return partially formatted string if placeholders run out
-    }
-
-    // Base case for the recursive format function.
-    std::string format(std::string formatString) const {
-        placeholderIndex = 0; // Reset index for the next call
-        return formatString;
-    }
-
-
-    std::unordered_map<std::string, nlohmann::json> languages_; // Stores loaded language data (langCode -> json object)
+    // A run of literal text or a placeholder within a translation. Placeholders keep the range of their "{n}" text,
+    // which is copied as it is if there is no argument n.
+    struct Piece {
+        size_t offset;
+        size_t length;
+        int argument; // -1 for literal text
+    };
+
+    struct Translation {
+        std::string text;
+        std::vector<Piece> pieces;
+    };
+
+    struct Language {
+        std::deque<std::string> keys; // Storage for the keys viewed by the table; a deque never moves its elements
+        std::unordered_map<std::string_view, Translation> table;
+    };
+
+    void addLanguage(const std::string& langCode, const std::string& jsonContent);
+    static std::vector<Piece> parse(const std::string& text);
+    const Translation* find(std::string_view key) const;
+    static std::string format(const Translation& translation, const Argument* arguments, size_t count);
+
+    std::unordered_map<std::string, Language> languages_; // Stores loaded language data (langCode -> flattened table)
     std::string currentLangCode_;                         // Currently active language code
-    mutable size_t placeholderIndex = 0;                  // Mutable index for formatting placeholders
+    const Language* currentLanguage_ = nullptr;           // Flattened table of the current language
 };
 
 // Global convenience function to get translations.
-inline std::string t(const std::string& key) {
+inline std::string t(std::string_view key) {
     return I18nManager::getInstance().get(key);
 }
 
 // Global convenience function to get formatted translations.
 template<typename... Args>
-inline std::string t(const std::string& key, Args&&... args) {
+inline std::string t(std::string_view key, Args&&... args) {
     return I18nManager::getInstance().get(key, std::forward<Args>(args)...);
 }
 
 } // namespace i18n
 
-#endif // I18N_H
\ No newline at end of file
+#endif // I18N_H
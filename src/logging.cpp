@@ -0,0 +1,57 @@
+#include "logging.h"
+
+#include <memory>
+#include <vector>
+
+#include <spdlog/async.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include "mcp_logger.h"
+
+namespace logging {
+
+// Number of messages the asynchronous logger queues before a caller has to wait for the logging thread
+static const size_t QUEUE_SIZE = 8192;
+
+static spdlog::level::level_enum s_spdlog_level(mcp::log_level level) {
+    switch (level) {
+        case mcp::log_level::debug:
+            return spdlog::level::debug;
+        case mcp::log_level::info:
+            return spdlog::level::info;
+        case mcp::log_level::warning:
+            return spdlog::level::warn;
+        default:
+            return spdlog::level::err;
+    }
+}
+
+static void s_mcp_sink(mcp::log_level level, const std::string& message) {
+    spdlog::default_logger_raw()->log(s_spdlog_level(level), message);
+}
+
+void init(bool stdio_mode) {
+    std::vector<spdlog::sink_ptr> sinks;
+    if (stdio_mode) {
+        sinks.push_back(std::make_shared<spdlog::sinks::stderr_color_sink_mt>());
+    } else {
+        sinks.push_back(std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
+    }
+
+    // A full queue blocks the caller rather than dropping messages, as errors must not get lost
+    spdlog::init_thread_pool(QUEUE_SIZE, 1);
+    auto logger = std::make_shared<spdlog::async_logger>("ExcelAutoCpp", sinks.begin(), sinks.end(), spdlog::thread_pool(),
+                                                         spdlog::async_overflow_policy::block);
+    logger->set_level(spdlog::default_logger_raw()->level());
+    spdlog::set_default_logger(logger);
+    spdlog::set_pattern("%^%L%$(%H:%M:%S) %v");
+
+    mcp::set_log_sink(s_mcp_sink);
+}
+
+void shutdown() {
+    mcp::set_log_sink(nullptr);
+    spdlog::shutdown();
+}
+
+} // namespace logging
@@ -0,0 +1,48 @@
+#ifndef LOGGING_H
+#define LOGGING_H
+
+#include <string_view>
+#include <utility>
+
+#include <spdlog/spdlog.h>
+
+#include "i18n.h"
+
+// Logging facade for translated messages. A message is only translated and formatted if its level is enabled, so
+// calls on hot paths (e.g. once per cell) cost a level comparison when the level is disabled. All messages of
+// ExcelAutoCpp and cpp-mcp go to one asynchronous logger, so that the calling thread never waits for the console.
+namespace logging {
+
+// Creates the asynchronous default logger and routes the cpp-mcp logger to it. In stdio mode stdout carries the
+// JSON-RPC stream, so all logging goes to stderr.
+void init(bool stdio_mode);
+
+// Flushes the queued messages and stops the logging thread.
+void shutdown();
+
+template<typename... Args>
+inline void log(spdlog::level::level_enum level, std::string_view key, Args&&... args) {
+    spdlog::logger* logger = spdlog::default_logger_raw();
+    if (logger->should_log(level)) {
+        logger->log(level, i18n::t(key, std::forward<Args>(args)...));
+    }
+}
+
+template<typename... Args>
+inline void info(std::string_view key, Args&&... args) {
+    log(spdlog::level::info, key, std::forward<Args>(args)...);
+}
+
+template<typename... Args>
+inline void warn(std::string_view key, Args&&... args) {
+    log(spdlog::level::warn, key, std::forward<Args>(args)...);
+}
+
+template<typename... Args>
+inline void error(std::string_view key, Args&&... args) {
+    log(spdlog::level::err, key, std::forward<Args>(args)...);
+}
+
+} // namespace logging
+
+#endif // LOGGING_H
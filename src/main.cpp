@@ -1,5 +1,6 @@
 // Include project headers first
 #include "i18n.h" // Include the i18n header
+#include "logging.h" // Translated, level-gated logging
 #include "embedded_translations.h" // Include the embedded translations
 // Include the precompiled header last among project headers
 #include "main.h"
@@ -7,11 +8,19 @@
 #include <string>
 #include <filesystem> // Required for path operations
 #include <algorithm> // for std::reverse
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <sstream>
 
+using ExcelWrapper::CellComment;
+using ExcelWrapper::CellRange;
 using ExcelWrapper::ExcelOperator;
+using ExcelWrapper::WorkbookCache;
 
 static const char DEFAULT_LANG[] = "zh-CN";
 static const int SERVER_PORT = 8888; 
+static const uint64_t WORKBOOK_CACHE_BUDGET = 1024ull * 1024 * 1024; // Estimated bytes of parsed workbooks kept resident
 
 static const char ASCII_ART[] = "\n\
 ░█▀▀░█░█░█▀▀░█▀▀░█░░░█▀█░█░█░▀█▀░█▀█\n\
@@ -19,8 +28,8 @@ static const char ASCII_ART[] = "\n\
 ░▀▀▀░▀░▀░▀▀▀░▀▀▀░▀▀▀░▀░▀░▀▀▀░░▀░░▀▀▀\n\
 v0.0.3                 By smileFAace\n";
  
-ExcelOperator g_excel_operator;
-std::string g_current_excel_file_path;
+WorkbookCache g_workbook_cache(WORKBOOK_CACHE_BUDGET);
+std::string g_current_excel_file_path; // Guarded by g_workbook_cache.mutex()
 
 
 // Helper function to convert column number to Excel column letter (e.g., 1 -> A, 27 -> AA)
@@ -55,55 +64,168 @@ static std::string s_getCellAddress(uint32_t row, uint32_t col) {
    return s_colNumberToLetters(col) + std::to_string(row);
 }
 
-void ensure_excel_open() {
+// Converts an element of a 'values' array to a cell value. Returns false if the JSON type has no cell equivalent.
+static bool s_jsonToCellValue(const mcp::json& cell_json, OpenXLSX::XLCellValue& value) {
+    if (cell_json.is_boolean()) {
+        value = cell_json.get<bool>();
+    } else if (cell_json.is_number_integer()) {
+        value = cell_json.get<int64_t>();
+    } else if (cell_json.is_number_float()) {
+        value = cell_json.get<double>();
+    } else if (cell_json.is_string()) {
+        value = cell_json.get<std::string>();
+    } else if (cell_json.is_null()) {
+        value.clear();
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Converts a CSV field to a cell value. Unquoted fields holding a number or TRUE/FALSE become numbers and booleans,
+// as when a CSV file is opened in Excel; quoted fields always stay strings.
+static OpenXLSX::XLCellValue s_csvFieldToCellValue(const std::string& field, bool quoted) {
+    if (quoted) {
+        return OpenXLSX::XLCellValue(field);
+    }
+    if (field.empty()) {
+        return OpenXLSX::XLCellValue();
+    }
+    if (field == "TRUE" || field == "true") {
+        return OpenXLSX::XLCellValue(true);
+    }
+    if (field == "FALSE" || field == "false") {
+        return OpenXLSX::XLCellValue(false);
+    }
+
+    const char* first = field.data();
+    const char* last = field.data() + field.size();
+    int64_t integer = 0;
+    auto integer_result = std::from_chars(first, last, integer);
+    if (integer_result.ec == std::errc() && integer_result.ptr == last) {
+        return OpenXLSX::XLCellValue(integer);
+    }
+    double number = 0;
+    auto number_result = std::from_chars(first, last, number);
+    if (number_result.ec == std::errc() && number_result.ptr == last && std::isfinite(number)) {
+        return OpenXLSX::XLCellValue(number);
+    }
+    return OpenXLSX::XLCellValue(field);
+}
+
+// Reads the next record of a CSV stream into values. Fields are separated by commas and may be enclosed in double
+// quotes, inside which commas, line breaks and doubled quotes ("") are taken literally (RFC 4180). Returns false at the
+// end of the stream.
+static bool s_readCsvRow(std::istream& in, std::vector<OpenXLSX::XLCellValue>& values) {
+    std::streambuf* buffer = in.rdbuf();
+    const int eof = std::char_traits<char>::eof();
+    int ch = buffer->sbumpc();
+    if (ch == eof) {
+        return false;
+    }
+
+    std::string field;
+    bool quoted = false;
+    bool in_quotes = false;
+    for (;; ch = buffer->sbumpc()) {
+        if (in_quotes) {
+            if (ch == eof) {
+                break;
+            }
+            if (ch != '"') {
+                field += static_cast<char>(ch);
+            } else if (buffer->sgetc() == '"') {
+                field += static_cast<char>(buffer->sbumpc());
+            } else {
+                in_quotes = false;
+            }
+        } else if (ch == '"' && field.empty() && !quoted) {
+            quoted = in_quotes = true;
+        } else if (ch == ',') {
+            values.push_back(s_csvFieldToCellValue(field, quoted));
+            field.clear();
+            quoted = false;
+        } else if (ch == '\n' || ch == eof) {
+            break;
+        } else if (ch != '\r' || buffer->sgetc() != '\n') {
+            field += static_cast<char>(ch);
+        }
+    }
+    values.push_back(s_csvFieldToCellValue(field, quoted));
+    return true;
+}
+
+// Throws if row row_number of a bulk write, holding column_count values, would not fit in a sheet.
+static void s_checkBulkRow(size_t row_number, size_t column_count) {
+    if (row_number > OpenXLSX::MAX_ROWS) {
+        logging::error("log.error.bulk_write_too_many_rows", OpenXLSX::MAX_ROWS);
+        throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.bulk_write_too_many_rows", OpenXLSX::MAX_ROWS));
+    }
+    if (column_count > OpenXLSX::MAX_COLS) {
+        logging::error("log.error.bulk_write_too_many_columns", row_number, column_count, OpenXLSX::MAX_COLS);
+        throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.bulk_write_too_many_columns", row_number, column_count, OpenXLSX::MAX_COLS));
+    }
+}
+
+// Returns the resident workbook for the current file path. Caller must hold g_workbook_cache.mutex().
+ExcelOperator& ensure_excel_open() {
     if (g_current_excel_file_path.empty()) {
-        spdlog::error(i18n::t("log.error.no_excel_path"));
+        logging::error("log.error.no_excel_path");
         throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.no_excel_path"));
     }
-    std::vector<std::string> dummy_sheet_names; // Only for open function signature
-    if (!g_excel_operator.open(g_current_excel_file_path, dummy_sheet_names)) {
-        spdlog::error(i18n::t("log.error.failed_open_excel", g_current_excel_file_path));
+    try {
+        return g_workbook_cache.acquire(g_current_excel_file_path);
+    } catch (const ExcelWrapper::StaleWorkbookError& e) {
+        logging::error("log.error.stale_workbook", g_current_excel_file_path);
+        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.stale_workbook", g_current_excel_file_path));
+    } catch (const std::exception& e) {
+        logging::error("log.error.failed_open_excel", g_current_excel_file_path);
         throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_open_excel", g_current_excel_file_path));
     }
 }
 
 mcp::json open_excel_and_list_sheets_handler(const mcp::json& params, const std::string& /* session_id */) {
     if (!params.contains("file_path")) {
-        spdlog::error(i18n::t("log.error.missing_params.create_xlsx")); // Reusing create_xlsx key as it's just file_path
+        logging::error("log.error.missing_params.create_xlsx"); // Reusing create_xlsx key as it's just file_path
         throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.missing_param.file_path"));
     }
 
     std::string file_path = params["file_path"].get<std::string>();
     std::vector<std::string> sheet_names;
 
-    if (g_excel_operator.open(file_path, sheet_names)) {
-        g_current_excel_file_path = file_path; // for global file path
-        mcp::json result_sheets = mcp::json::array();
-        for (const auto& name : sheet_names) {
-            result_sheets.push_back(name);
-        }
-        mcp::json result = {
-            {
-                {"type", "text"},
-                {"text", result_sheets.dump()}
-            }
-        };
-        g_excel_operator.close();
-        spdlog::info(i18n::t("log.info.opened_excel", file_path));
-        return result;
-    } else {
-        spdlog::error(i18n::t("log.error.failed_open_or_list", file_path));
+    std::lock_guard<std::mutex> cache_lock(g_workbook_cache.mutex());
+    try {
+        sheet_names = g_workbook_cache.acquire(file_path).sheetNames();
+    } catch (const ExcelWrapper::StaleWorkbookError& e) {
+        logging::error("log.error.stale_workbook", file_path);
+        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.stale_workbook", file_path));
+    } catch (const std::exception& e) {
+        logging::error("log.error.failed_open_or_list", file_path);
         throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_open_or_list", file_path));
     }
+
+    g_current_excel_file_path = file_path; // for global file path
+    mcp::json result_sheets = mcp::json::array();
+    for (const auto& name : sheet_names) {
+        result_sheets.push_back(name);
+    }
+    mcp::json result = {
+        {
+            {"type", "text"},
+            {"text", result_sheets.dump()}
+        }
+    };
+    logging::info("log.info.opened_excel", file_path);
+    return result;
 }
 
 mcp::json get_sheet_range_content_handler(const mcp::json& params, const std::string& /* session_id */) {
-    ensure_excel_open();
+    std::lock_guard<std::mutex> cache_lock(g_workbook_cache.mutex());
+    ExcelOperator& excel = ensure_excel_open();
 
     if (!params.contains("sheet_name") || !params.contains("first_row") || !params.contains("first_column") ||
         !params.contains("last_row") || !params.contains("last_column")) {
-        g_excel_operator.close();
-        spdlog::error(i18n::t("log.error.missing_params.get_range"));
+        logging::error("log.error.missing_params.get_range");
         throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.missing_params.get_range"));
     }
 
@@ -119,20 +241,20 @@ mcp::json get_sheet_range_content_handler(const mcp::json& params, const std::st
     uint32_t last_row = params["last_row"].get<uint32_t>();
     uint32_t last_column = params["last_column"].get<uint32_t>();
 
-    if (!g_excel_operator.selectSheet(sheet_name)) {
-        g_excel_operator.close();
-        spdlog::error(i18n::t("log.error.failed_select_sheet", sheet_name));
+    if (!excel.selectSheet(sheet_name)) {
+        logging::error("log.error.failed_select_sheet", sheet_name);
         throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_select_sheet", sheet_name));
     }
 
-    std::vector<std::vector<OpenXLSX::XLCellValue>> range_values =
-        g_excel_operator.getRangeValues(first_row, first_column, last_row, last_column);
-
     mcp::json result_array = mcp::json::array();
-    if (seperate_cell)
+    uint32_t width = last_column >= first_column ? last_column - first_column + 1 : 0;
+    uint32_t next_row = first_row;
+
+    // Rows are serialized as they are read; rows missing from the sheet only need filling in the non-coordinate layout
+    excel.visitRangeRows(first_row, first_column, last_row, last_column,
+        [&](uint32_t row_number, const std::vector<OpenXLSX::XLCellValue>& row)
     {
-        uint32_t current_row = first_row;
-        for (const auto& row : range_values)
+        if (seperate_cell)
         {
             uint32_t current_col = first_column;
             for (const auto& cell_value : row)
@@ -150,8 +272,8 @@ mcp::json get_sheet_range_content_handler(const mcp::json& params, const std::st
                     }
                     else if (cell_value.type() == OpenXLSX::XLValueType::Float)
                     {
-                        // Use std::ostringstream for better float formatting if needed
-                        cell_content_str = std::to_string(cell_value.get<double>());
+                        // Shortest text that reads back as the same value, e.g. 0.1 rather than 0.100000
+                        cell_content_str = OpenXLSX::formatFloat(cell_value.get<double>());
                     }
                     else if (cell_value.type() == OpenXLSX::XLValueType::String)
                     {
@@ -164,21 +286,21 @@ mcp::json get_sheet_range_content_handler(const mcp::json& params, const std::st
                         } catch (const OpenXLSX::XLValueTypeError& e) {
                            // Handle cases where conversion to string might fail for unexpected types
                            cell_content_str = i18n::t("result.unsupported_type");
-                           spdlog::warn(i18n::t("log.warn.unsupported_cell_type.get_range", current_row, current_col, e.what()));
+                           logging::warn("log.warn.unsupported_cell_type.get_range", row_number, current_col, e.what());
                         }
                     }
-                    std::string cell_address = s_getCellAddress(current_row, current_col);
+                    std::string cell_address = s_getCellAddress(row_number, current_col);
                     result_array.push_back(cell_content_str + "@" + cell_address);
                 }
                 current_col++;
             }
-            current_row++;
         }
-    }
-    else
-    {
-        for (const auto& row : range_values)
+        else
         {
+            for (; next_row < row_number; ++next_row)
+            {
+                result_array.push_back(mcp::json::array_t(width));
+            }
             mcp::json row_array = mcp::json::array();
             for (const auto& cell_value : row)
             {
@@ -205,11 +327,20 @@ mcp::json get_sheet_range_content_handler(const mcp::json& params, const std::st
                      } catch (const OpenXLSX::XLValueTypeError& e) {
                         row_array.push_back(i18n::t("result.unsupported_type"));
                          // Optionally log the error with row/col if needed, though harder without tracking here
-                        spdlog::warn(i18n::t("log.warn.unsupported_cell_type.standard", e.what()));
+                        logging::warn("log.warn.unsupported_cell_type.standard", e.what());
                      }
                 }
             }
-            result_array.push_back(row_array);
+            result_array.push_back(std::move(row_array));
+            next_row = row_number + 1;
+        }
+    });
+
+    if (!seperate_cell)
+    {
+        for (; next_row <= last_row && next_row >= first_row; ++next_row)
+        {
+            result_array.push_back(mcp::json::array_t(width));
         }
     }
 
@@ -219,43 +350,80 @@ mcp::json get_sheet_range_content_handler(const mcp::json& params, const std::st
             {"text", result_array.dump()}
         }
     };
-    g_excel_operator.close();
-    spdlog::info(i18n::t("log.info.retrieved_range", sheet_name));
+    logging::info("log.info.retrieved_range", sheet_name);
     return result;
 }
 
 mcp::json create_xlsx_file_handler(const mcp::json& params, const std::string& /* session_id */) {
     if (!params.contains("file_path")) {
-        spdlog::error(i18n::t("log.error.missing_params.create_xlsx"));
+        logging::error("log.error.missing_params.create_xlsx");
         throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.missing_param.file_path_create"));
     }
 
     std::string file_path = params["file_path"].get<std::string>();
 
-    if (g_excel_operator.create(file_path)) {
-        g_current_excel_file_path = file_path;
-        mcp::json result = {
-            {
-                {"type", "text"},
-                {"text", i18n::t("result.created_excel", file_path)}
-            }
-        };
-        g_excel_operator.close();
-        spdlog::info(i18n::t("log.info.created_excel", file_path));
-        return result;
-    } else {
-        spdlog::error(i18n::t("log.error.failed_create_excel", file_path));
+    std::lock_guard<std::mutex> cache_lock(g_workbook_cache.mutex());
+    try {
+        g_workbook_cache.create(file_path);
+    } catch (const std::exception& e) {
+        logging::error("log.error.failed_create_excel", file_path);
         throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_create_excel", file_path));
     }
+
+    g_current_excel_file_path = file_path;
+    mcp::json result = {
+        {
+            {"type", "text"},
+            {"text", i18n::t("result.created_excel", file_path)}
+        }
+    };
+    logging::info("log.info.created_excel", file_path);
+    return result;
+}
+
+mcp::json get_sheet_used_range_handler(const mcp::json& params, const std::string& /* session_id */) {
+    std::lock_guard<std::mutex> cache_lock(g_workbook_cache.mutex());
+    ExcelOperator& excel = ensure_excel_open();
+
+    if (!params.contains("sheet_name")) {
+        logging::error("log.error.missing_params.get_used_range");
+        throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.missing_params.get_used_range"));
+    }
+
+    std::string sheet_name = params["sheet_name"].get<std::string>();
+    if (!excel.selectSheet(sheet_name)) {
+        logging::error("log.error.failed_select_sheet", sheet_name);
+        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_select_sheet", sheet_name));
+    }
+
+    // The used range is stored in the sheet's <dimension> element and maintained by the worksheet, so this does not depend on
+    // the size of the sheet; a sheet that has not been loaded yet is not parsed for it
+    CellRange range{};
+    std::string text;
+    if (excel.usedRange(range)) {
+        std::string address = s_getCellAddress(range.firstRow, range.firstColumn) + ":" + s_getCellAddress(range.lastRow, range.lastColumn);
+        text = i18n::t("result.used_range", sheet_name, address, range.firstRow, range.firstColumn, range.lastRow, range.lastColumn);
+    } else {
+        text = i18n::t("result.used_range_empty", sheet_name);
+    }
+
+    mcp::json result = {
+        {
+            {"type", "text"},
+            {"text", text}
+        }
+    };
+    logging::info("log.info.retrieved_used_range", sheet_name);
+    return result;
 }
 
 mcp::json set_sheet_range_content_handler(const mcp::json& params, const std::string& /* session_id */) {
-    ensure_excel_open();
+    std::lock_guard<std::mutex> cache_lock(g_workbook_cache.mutex());
+    ExcelOperator& excel = ensure_excel_open();
 
     if (!params.contains("sheet_name") || !params.contains("first_row") || !params.contains("first_column") ||
         !params.contains("values")) {
-        g_excel_operator.close();
-        spdlog::error(i18n::t("log.error.missing_params.set_range"));
+        logging::error("log.error.missing_params.set_range");
         throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.missing_params.set_range"));
     }
 
@@ -265,83 +433,317 @@ mcp::json set_sheet_range_content_handler(const mcp::json& params, const std::st
     mcp::json json_values = params["values"];
 
     if (!json_values.is_array()) {
-        g_excel_operator.close();
-        spdlog::error(i18n::t("log.error.values_not_2d_array"));
+        logging::error("log.error.values_not_2d_array");
         throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.values_not_2d_array"));
     }
 
     std::vector<std::vector<OpenXLSX::XLCellValue>> values_to_set;
     for (const auto& row_json : json_values) {
         if (!row_json.is_array()) {
-            g_excel_operator.close();
-            spdlog::error(i18n::t("log.error.values_row_not_array"));
+            logging::error("log.error.values_row_not_array");
             throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.values_row_not_array"));
         }
-        std::vector<OpenXLSX::XLCellValue> row_values;
-        for (const auto& cell_json : row_json) {
-            if (cell_json.is_boolean()) {
-                row_values.push_back(OpenXLSX::XLCellValue(cell_json.get<bool>()));
-            } else if (cell_json.is_number_integer()) {
-                row_values.push_back(OpenXLSX::XLCellValue(cell_json.get<int64_t>()));
-            } else if (cell_json.is_number_float()) {
-                row_values.push_back(OpenXLSX::XLCellValue(cell_json.get<double>()));
-            } else if (cell_json.is_string()) {
-                row_values.push_back(OpenXLSX::XLCellValue(cell_json.get<std::string>()));
-            } else if (cell_json.is_null()) {
-                row_values.push_back(OpenXLSX::XLCellValue());
-            } else {
-                g_excel_operator.close();
-                spdlog::error(i18n::t("log.error.unsupported_cell_type.set_range"));
+        std::vector<OpenXLSX::XLCellValue> row_values(row_json.size());
+        for (size_t i = 0; i < row_json.size(); ++i) {
+            if (!s_jsonToCellValue(row_json[i], row_values[i])) {
+                logging::error("log.error.unsupported_cell_type.set_range");
                 throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.unsupported_cell_type.set_range"));
             }
         }
-        values_to_set.push_back(row_values);
+        values_to_set.push_back(std::move(row_values));
+    }
+
+    size_t width = 0;
+    for (const auto& row_values : values_to_set) {
+        width = std::max(width, row_values.size());
+    }
+    if (first_row < 1 || first_column < 1 || first_row - 1 + uint64_t(values_to_set.size()) > OpenXLSX::MAX_ROWS ||
+        first_column - 1 + uint64_t(width) > OpenXLSX::MAX_COLS) {
+        logging::error("log.error.range_out_of_sheet", first_row, first_column, values_to_set.size(), width);
+        throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.range_out_of_sheet", first_row, first_column, values_to_set.size(), width));
     }
 
-    if (!g_excel_operator.selectSheet(sheet_name)) {
-        g_excel_operator.close();
-        spdlog::error(i18n::t("log.error.failed_select_sheet", sheet_name));
+    if (!excel.selectSheet(sheet_name)) {
+        logging::error("log.error.failed_select_sheet", sheet_name);
         throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_select_sheet", sheet_name));
     }
 
-    if (g_excel_operator.setRangeValues(first_row, first_column, values_to_set)) {
+    // The input was checked above, so a failure is rejected before anything is written unless the write stops part
+    // way, in which case the committed file is the only consistent state left
+    bool range_set = false;
+    try {
+        range_set = excel.setRangeValues(first_row, first_column, values_to_set);
+    } catch (const std::exception& e) {
+        g_workbook_cache.discard(g_current_excel_file_path);
+        logging::error("log.error.write_failed_changes_dropped", sheet_name, e.what(), g_current_excel_file_path);
+        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.write_failed_changes_dropped", sheet_name, e.what(), g_current_excel_file_path));
+    }
+
+    if (range_set) {
+        g_workbook_cache.markDirty(g_current_excel_file_path);
         mcp::json result = {
             {
                 {"type", "text"},
                 {"text", i18n::t("result.set_range")}
             }
         };
-        g_excel_operator.close();
-        spdlog::info(i18n::t("log.info.set_range", sheet_name));
+        logging::info("log.info.set_range", sheet_name);
         return result;
     } else {
-        g_excel_operator.close();
-        spdlog::error(i18n::t("log.error.failed_set_range", sheet_name));
+        logging::error("log.error.failed_set_range", sheet_name);
         throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_set_range"));
     }
 }
 
-static void s_spdlog_init() {
+mcp::json bulk_write_sheet_content_handler(const mcp::json& params, const std::string& /* session_id */) {
+    std::lock_guard<std::mutex> cache_lock(g_workbook_cache.mutex());
+    ExcelOperator& excel = ensure_excel_open();
 
-    spdlog::set_pattern("%^%L%$(%H:%M:%S) %v");
+    int sources = params.contains("csv") + params.contains("csv_file_path") + params.contains("values");
+    if (!params.contains("sheet_name") || sources != 1) {
+        logging::error("log.error.missing_params.bulk_write");
+        throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.missing_params.bulk_write"));
+    }
 
-    bool console_sink_exists = false;
-    for (const auto& sink : spdlog::default_logger()->sinks()) {
-        if (std::dynamic_pointer_cast<spdlog::sinks::stdout_color_sink_mt>(sink)) {
-            console_sink_exists = true;
-            break;
+    std::string sheet_name = params["sheet_name"].get<std::string>();
+
+    // Rows are converted one at a time as the sheet is written, so the cells of the whole table are never held at once
+    std::unique_ptr<std::istream> csv_stream;
+    if (params.contains("csv")) {
+        csv_stream = std::make_unique<std::istringstream>(params["csv"].get<std::string>());
+    } else if (params.contains("csv_file_path")) {
+        std::string csv_file_path = params["csv_file_path"].get<std::string>();
+        auto csv_file = std::make_unique<std::ifstream>(std::filesystem::u8path(csv_file_path), std::ios::binary);
+        if (!csv_file->is_open()) {
+            logging::error("log.error.failed_open_csv", csv_file_path);
+            throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.failed_open_csv", csv_file_path));
         }
+        csv_stream = std::move(csv_file);
     }
 
-    if (!console_sink_exists) {
-        auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-        spdlog::default_logger()->sinks().push_back(console_sink);
+    ExcelOperator::RowSource source;
+    const mcp::json* json_values = params.contains("values") ? &params["values"] : nullptr;
+    size_t next_row = 0;
+    if (csv_stream) {
+        // A UTF-8 byte order mark, as written by Excel, is not part of the first field
+        char bom[3] = {};
+        csv_stream->read(bom, 3);
+        if (csv_stream->gcount() != 3 || std::string(bom, 3) != "\xEF\xBB\xBF") {
+            csv_stream->clear();
+            csv_stream->seekg(0);
+        }
+
+        // Writing replaces the sheet as it goes, so the shape of the table is checked in a first pass over the CSV
+        std::streampos first_record = csv_stream->tellg();
+        std::vector<OpenXLSX::XLCellValue> record;
+        size_t row_count = 0;
+        while (s_readCsvRow(*csv_stream, record)) {
+            s_checkBulkRow(++row_count, record.size());
+            record.clear();
+        }
+        csv_stream->clear();
+        csv_stream->seekg(first_record);
+
+        source = [&](std::vector<OpenXLSX::XLCellValue>& values) {
+            return s_readCsvRow(*csv_stream, values);
+        };
+    } else {
+        // Checked before anything is written, so that invalid input leaves the sheet untouched
+        if (!json_values->is_array()) {
+            logging::error("log.error.values_not_2d_array");
+            throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.values_not_2d_array"));
+        }
+        OpenXLSX::XLCellValue value;
+        size_t row_count = 0;
+        for (const auto& row_json : *json_values) {
+            if (!row_json.is_array()) {
+                logging::error("log.error.values_row_not_array");
+                throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.values_row_not_array"));
+            }
+            s_checkBulkRow(++row_count, row_json.size());
+            for (const auto& cell_json : row_json) {
+                if (!s_jsonToCellValue(cell_json, value)) {
+                    logging::error("log.error.unsupported_cell_type.set_range");
+                    throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.unsupported_cell_type.set_range"));
+                }
+            }
+        }
+        source = [&](std::vector<OpenXLSX::XLCellValue>& values) {
+            if (next_row == json_values->size()) {
+                return false;
+            }
+            const mcp::json& row_json = (*json_values)[next_row++];
+            values.resize(row_json.size());
+            for (size_t i = 0; i < row_json.size(); ++i) {
+                s_jsonToCellValue(row_json[i], values[i]);
+            }
+            return true;
+        };
+    }
+
+    // The input was checked above; a write that still stops part way has replaced only part of the sheet, and the
+    // committed file is the only consistent state left
+    uint32_t row_count = 0;
+    bool rows_written = false;
+    try {
+        rows_written = excel.writeSheetRows(sheet_name, source, row_count);
+    } catch (const std::exception& e) {
+        g_workbook_cache.discard(g_current_excel_file_path);
+        logging::error("log.error.write_failed_changes_dropped", sheet_name, e.what(), g_current_excel_file_path);
+        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.write_failed_changes_dropped", sheet_name, e.what(), g_current_excel_file_path));
+    }
+
+    if (!rows_written) {
+        logging::error("log.error.failed_bulk_write", sheet_name);
+        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_bulk_write", sheet_name));
+    }
+
+    g_workbook_cache.markDirty(g_current_excel_file_path);
+    mcp::json result = {
+        {
+            {"type", "text"},
+            {"text", i18n::t("result.bulk_written", row_count, sheet_name)}
+        }
+    };
+    logging::info("log.info.bulk_written", row_count, sheet_name);
+    return result;
+}
+
+mcp::json set_sheet_range_comments_handler(const mcp::json& params, const std::string& /* session_id */) {
+    std::lock_guard<std::mutex> cache_lock(g_workbook_cache.mutex());
+    ExcelOperator& excel = ensure_excel_open();
+
+    if (!params.contains("sheet_name") || !params.contains("first_row") || !params.contains("first_column") ||
+        !params.contains("comments")) {
+        logging::error("log.error.missing_params.set_comments");
+        throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.missing_params.set_comments"));
+    }
+
+    std::string sheet_name = params["sheet_name"].get<std::string>();
+    uint32_t first_row = params["first_row"].get<uint32_t>();
+    uint32_t first_column = params["first_column"].get<uint32_t>();
+    std::string author = params.value("author", std::string("ExcelAutoCpp"));
+    const mcp::json& json_comments = params["comments"];
+
+    // Cells whose entry is null (or a row that is shorter than others) keep their current comment
+    std::vector<CellComment> comments;
+    bool comments_valid = json_comments.is_array();
+    for (size_t r = 0; comments_valid && r < json_comments.size(); ++r) {
+        const mcp::json& row_json = json_comments[r];
+        comments_valid = row_json.is_array();
+        for (size_t c = 0; comments_valid && c < row_json.size(); ++c) {
+            if (row_json[c].is_string()) {
+                comments.push_back({first_row + static_cast<uint32_t>(r), first_column + static_cast<uint32_t>(c),
+                                    row_json[c].get<std::string>()});
+            } else {
+                comments_valid = row_json[c].is_null();
+            }
+        }
+    }
+    if (!comments_valid) {
+        logging::error("log.error.comments_not_2d_array");
+        throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.comments_not_2d_array"));
+    }
+    for (const auto& comment : comments) {
+        if (comment.row < 1 || comment.row > OpenXLSX::MAX_ROWS || comment.column < 1 || comment.column > OpenXLSX::MAX_COLS) {
+            logging::error("log.error.comment_out_of_sheet", comment.row, comment.column);
+            throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.comment_out_of_sheet", comment.row, comment.column));
+        }
+    }
+
+    if (!excel.selectSheet(sheet_name)) {
+        logging::error("log.error.failed_select_sheet", sheet_name);
+        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_select_sheet", sheet_name));
+    }
+
+    // The cells were checked above; a failure past that point may have left the comments part half updated
+    bool comments_set = false;
+    try {
+        comments_set = excel.setComments(comments, author);
+    } catch (const std::exception& e) {
+        g_workbook_cache.discard(g_current_excel_file_path);
+        logging::error("log.error.write_failed_changes_dropped", sheet_name, e.what(), g_current_excel_file_path);
+        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.write_failed_changes_dropped", sheet_name, e.what(), g_current_excel_file_path));
+    }
+
+    if (!comments_set) {
+        logging::error("log.error.failed_set_comments", sheet_name);
+        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_set_comments", sheet_name));
     }
+
+    g_workbook_cache.markDirty(g_current_excel_file_path);
+    mcp::json result = {
+        {
+            {"type", "text"},
+            {"text", i18n::t("result.set_comments", comments.size(), sheet_name)}
+        }
+    };
+    logging::info("log.info.set_comments", comments.size(), sheet_name);
+    return result;
 }
 
+mcp::json commit_workbook_handler(const mcp::json& params, const std::string& /* session_id */) {
+    std::lock_guard<std::mutex> cache_lock(g_workbook_cache.mutex());
+
+    std::string file_path = g_current_excel_file_path;
+    if (params.contains("file_path") && !params["file_path"].get<std::string>().empty()) {
+        file_path = params["file_path"].get<std::string>();
+    }
+    if (file_path.empty()) {
+        logging::error("log.error.no_excel_path");
+        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.no_excel_path"));
+    }
+
+    bool committed = false;
+    try {
+        committed = g_workbook_cache.commit(file_path);
+    } catch (const std::exception& e) {
+        logging::error("log.error.failed_commit", file_path);
+        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_commit", file_path));
+    }
+
+    if (!committed) {
+        logging::error("log.error.commit_not_open", file_path);
+        throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.commit_not_open", file_path));
+    }
 
+    mcp::json result = {
+        {
+            {"type", "text"},
+            {"text", i18n::t("result.committed", file_path)}
+        }
+    };
+    logging::info("log.info.committed", file_path);
+    return result;
+}
 
-static void s_mcpServer_init(mcp::server& server, bool blocking_mode) {
+mcp::json flush_workbook_cache_handler(const mcp::json& params, const std::string& /* session_id */) {
+    std::lock_guard<std::mutex> cache_lock(g_workbook_cache.mutex());
+
+    // Dropping changes is limited to a single named workbook, so that one call cannot lose the edits of every file
+    bool discard_changes = params.contains("discard_changes") && params["discard_changes"].get<bool>();
+    size_t released = 0;
+    if (params.contains("file_path") && !params["file_path"].get<std::string>().empty()) {
+        std::string file_path = params["file_path"].get<std::string>();
+        released = (discard_changes ? g_workbook_cache.discard(file_path) : g_workbook_cache.evict(file_path)) ? 1 : 0;
+    } else if (discard_changes) {
+        logging::error("log.error.missing_params.flush_discard");
+        throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.missing_params.flush_discard"));
+    } else {
+        released = g_workbook_cache.evictAll();
+    }
+
+    mcp::json result = {
+        {
+            {"type", "text"},
+            {"text", i18n::t("result.flushed_cache", released)}
+        }
+    };
+    logging::info("log.info.flushed_cache", released);
+    return result;
+}
+
+static void s_mcpServer_init(mcp::server& server, bool blocking_mode, bool stdio_mode) {
     server.set_server_info("ExcelAutoCpp", "1.0.0"); // Server name/version likely not translated
 
     mcp::json capabilities = {
@@ -366,6 +768,12 @@ static void s_mcpServer_init(mcp::server& server, bool blocking_mode) {
         .build();
     server.register_tool(get_range_tool, get_sheet_range_content_handler);
 
+    mcp::tool get_used_range_tool = mcp::tool_builder("get_sheet_used_range")
+        .with_description(i18n::t("tool.get_used_range.description"))
+        .with_string_param("sheet_name", i18n::t("tool.get_used_range.param.sheet_name"))
+        .build();
+    server.register_tool(get_used_range_tool, get_sheet_used_range_handler);
+
     mcp::tool set_range_tool = mcp::tool_builder("set_sheet_range_content")
         .with_description(i18n::t("tool.set_range.description"))
         .with_string_param("sheet_name", i18n::t("tool.set_range.param.sheet_name"))
@@ -375,14 +783,57 @@ static void s_mcpServer_init(mcp::server& server, bool blocking_mode) {
         .build();
     server.register_tool(set_range_tool, set_sheet_range_content_handler);
 
+    mcp::tool bulk_write_tool = mcp::tool_builder("bulk_write_sheet_content")
+        .with_description(i18n::t("tool.bulk_write.description"))
+        .with_string_param("sheet_name", i18n::t("tool.bulk_write.param.sheet_name"))
+        .with_string_param("csv", i18n::t("tool.bulk_write.param.csv"), false)
+        .with_string_param("csv_file_path", i18n::t("tool.bulk_write.param.csv_file_path"), false)
+        .with_array_param("values", i18n::t("tool.bulk_write.param.values"), "object", false)
+        .build();
+    server.register_tool(bulk_write_tool, bulk_write_sheet_content_handler);
+
+    mcp::tool set_comments_tool = mcp::tool_builder("set_sheet_range_comments")
+        .with_description(i18n::t("tool.set_comments.description"))
+        .with_string_param("sheet_name", i18n::t("tool.set_comments.param.sheet_name"))
+        .with_number_param("first_row", i18n::t("tool.set_comments.param.first_row"))
+        .with_number_param("first_column", i18n::t("tool.set_comments.param.first_column"))
+        .with_array_param("comments", i18n::t("tool.set_comments.param.comments"), "object")
+        .with_string_param("author", i18n::t("tool.set_comments.param.author"), false)
+        .build();
+    server.register_tool(set_comments_tool, set_sheet_range_comments_handler);
+
     mcp::tool create_xlsx_tool = mcp::tool_builder("create_xlsx_file_by_absolute_path")
        .with_description(i18n::t("tool.create_xlsx.description"))
        .with_string_param("file_path", i18n::t("tool.create_xlsx.param.file_path"))
        .build();
     server.register_tool(create_xlsx_tool, create_xlsx_file_handler);
 
-    spdlog::info(i18n::t("log.info.server_start", SERVER_PORT));
-    spdlog::info(i18n::t("log.info.server_stop_prompt"));
+    mcp::tool commit_tool = mcp::tool_builder("commit_workbook")
+       .with_description(i18n::t("tool.commit.description"))
+       .with_string_param("file_path", i18n::t("tool.commit.param.file_path"), false)
+       .build();
+    server.register_tool(commit_tool, commit_workbook_handler);
+
+    mcp::tool flush_cache_tool = mcp::tool_builder("flush_workbook_cache")
+       .with_description(i18n::t("tool.flush_cache.description"))
+       .with_string_param("file_path", i18n::t("tool.flush_cache.param.file_path"), false)
+       .with_boolean_param("discard_changes", i18n::t("tool.flush_cache.param.discard_changes"), false)
+       .build();
+    server.register_tool(flush_cache_tool, flush_workbook_cache_handler);
+
+    if (stdio_mode) {
+        logging::info("log.info.server_start_stdio");
+        // stdout carries only protocol messages: the server writes to its own stream on the stdout buffer, and anything
+        // else written to std::cout (e.g. OpenXLSX warnings) goes to stderr
+        std::ostream protocol_out(std::cout.rdbuf());
+        std::cout.rdbuf(std::cerr.rdbuf());
+        server.start_stdio(std::cin, protocol_out);
+        std::cout.rdbuf(protocol_out.rdbuf());
+        return;
+    }
+
+    logging::info("log.info.server_start", SERVER_PORT);
+    logging::info("log.info.server_stop_prompt");
 
 
     server.start(blocking_mode);
@@ -439,22 +890,31 @@ static void s_i18n_init() {
 
 
 
-int main() {
+int main(int argc, char* argv[]) {
 #ifdef _WIN32
     SetConsoleOutputCP(CP_UTF8);
 #endif
 
-    std::cout << ASCII_ART << std::endl;
+    // --stdio serves a single client over stdin/stdout instead of HTTP+SSE
+    bool stdio_mode = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--stdio") {
+            stdio_mode = true;
+        }
+    }
+
+    (stdio_mode ? std::cerr : std::cout) << ASCII_ART << std::endl;
 
     spdlog::set_level(spdlog::level::info);
-    s_spdlog_init();
+    logging::init(stdio_mode);
 
     s_i18n_init(); 
 
 
     mcp::server server("localhost", SERVER_PORT);
     mcp::set_log_level(mcp::log_level::error); // Keep MCP library logs concise
-    s_mcpServer_init(server, true);
+    s_mcpServer_init(server, true, stdio_mode);
 
+    logging::shutdown();
     return 0;
 }
@@ -15,5 +15,6 @@
 #include <spdlog/sinks/stdout_color_sinks.h> // Include console color output sink
 
 #include "ExcelOperator.h"
+#include "WorkbookCache.h"
 
 #endif //_MAIN_H_
\ No newline at end of file